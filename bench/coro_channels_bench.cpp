@@ -0,0 +1,190 @@
+// Per-message consumer overhead: one scheduler thread multiplexing N channels with coroutines
+// vs. the thread-per-consumer model used by EventBus (spin, yield every 0x3FFF failed pops).
+//
+// Usage: coro_bench [messages_per_channel]
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+#include "coro_channel.h"
+#include "event.h"
+#include "latency_tracker.h"
+
+namespace {
+
+using Ring = SpscRingBuffer<spsc::Event>;
+
+constexpr std::size_t kRingCapacity = 1024;
+
+struct Result {
+    double secs{0.0};
+    std::uint64_t consumed{0};
+    std::uint64_t idle_polls{0};
+};
+
+// Low-rate feed: producer round-robins over all rings, one event per ring per pass
+void produce(std::vector<std::unique_ptr<Ring>>& rings, std::uint64_t per_channel) {
+    for (std::uint64_t seq = 0; seq < per_channel; ++seq) {
+        for (auto& rb : rings) {
+            spsc::Event e{};
+            e.seq = seq;
+            e.enqueue_ns = spsc::LatencyTracker::now_ns();
+            while (!rb->try_push(e)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
+
+spsc::Task consume(spsc::Channel<spsc::Event>& ch, std::uint64_t n, std::uint64_t& consumed) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+        const spsc::Event e = co_await ch.next();
+        consumed += (e.seq == i) ? 1 : 0;
+    }
+}
+
+Result run_coroutines(std::size_t channels, std::uint64_t per_channel) {
+    std::vector<std::unique_ptr<Ring>> rings;
+    for (std::size_t i = 0; i < channels; ++i) rings.push_back(std::make_unique<Ring>(kRingCapacity));
+
+    std::atomic<bool> spawned{false};
+    Result r{};
+
+    std::thread consumer([&] {
+        spsc::FramePool::local().reserve(channels);
+
+        spsc::PollScheduler sched;
+        std::vector<spsc::Channel<spsc::Event>> chans;
+        std::vector<spsc::Task> tasks;
+        chans.reserve(channels);
+        tasks.reserve(channels);
+
+        std::uint64_t consumed = 0;
+        for (std::size_t i = 0; i < channels; ++i) chans.emplace_back(*rings[i], sched);
+        for (std::size_t i = 0; i < channels; ++i) {
+            tasks.push_back(consume(chans[i], per_channel, consumed));
+            sched.spawn(tasks.back());
+        }
+
+        // All coroutines are parked on empty rings before the producer starts
+        spawned.store(true, std::memory_order_release);
+
+        const auto t0 = std::chrono::steady_clock::now();
+        while (sched.waiting() != 0) {
+            if (sched.poll() == 0) {
+                ++r.idle_polls;
+            }
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+
+        r.secs = std::chrono::duration<double>(t1 - t0).count();
+        r.consumed = consumed;
+    });
+
+    while (!spawned.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+    produce(rings, per_channel);
+    consumer.join();
+    return r;
+}
+
+Result run_threads(std::size_t channels, std::uint64_t per_channel) {
+    std::vector<std::unique_ptr<Ring>> rings;
+    for (std::size_t i = 0; i < channels; ++i) rings.push_back(std::make_unique<Ring>(kRingCapacity));
+
+    std::atomic<std::uint64_t> consumed{0};
+    std::atomic<std::uint64_t> idle{0};
+    std::atomic<std::size_t> parked{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> consumers;
+    consumers.reserve(channels);
+
+    for (std::size_t i = 0; i < channels; ++i) {
+        consumers.emplace_back([&, i] {
+            Ring& rb = *rings[i];
+
+            parked.fetch_add(1, std::memory_order_release);
+            go.wait(false, std::memory_order_acquire);
+
+            std::uint64_t got = 0;
+            std::uint64_t pop_fail_spins = 0;
+
+            while (got < per_channel) {
+                spsc::Event e{};
+                if (rb.try_pop(e)) {
+                    got += (e.seq == got) ? 1 : 0;
+                }
+                else {
+                    ++pop_fail_spins;
+                    if ((pop_fail_spins & 0x3FFFu) == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            consumed.fetch_add(got, std::memory_order_relaxed);
+            idle.fetch_add(pop_fail_spins, std::memory_order_relaxed);
+        });
+    }
+
+    // Thread creation is setup, like the coroutine side's frame pool: time only the traffic
+    while (parked.load(std::memory_order_acquire) != channels) {
+        std::this_thread::yield();
+    }
+    const auto t0 = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    go.notify_all();
+
+    produce(rings, per_channel);
+    for (auto& t : consumers) t.join();
+
+    const auto t1 = std::chrono::steady_clock::now();
+
+    Result r{};
+    r.secs = std::chrono::duration<double>(t1 - t0).count();
+    r.consumed = consumed.load();
+    r.idle_polls = idle.load();
+    return r;
+}
+
+void print_row(const char* model, std::size_t channels, const Result& r) {
+    const double per_msg_ns = r.consumed ? (r.secs * 1e9) / static_cast<double>(r.consumed) : 0.0;
+
+    std::cout << std::left << std::setw(12) << model
+              << std::right << std::setw(10) << channels
+              << std::setw(14) << r.consumed
+              << std::setw(14) << std::fixed << std::setprecision(6) << r.secs
+              << std::setw(16) << std::fixed << std::setprecision(1) << per_msg_ns
+              << std::setw(16) << r.idle_polls << "\n";
+}
+
+}//namespace
+
+int main(int argc, char** argv) {
+    const std::uint64_t per_channel = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200;
+
+    std::cout << "=== Coroutine channels vs thread-per-consumer ===\n";
+    std::cout << "Messages per channel: " << per_channel << "\n\n";
+    std::cout << std::left << std::setw(12) << "model"
+              << std::right << std::setw(10) << "channels"
+              << std::setw(14) << "consumed"
+              << std::setw(14) << "elapsed(s)"
+              << std::setw(16) << "ns/msg"
+              << std::setw(16) << "idle polls" << "\n";
+
+    for (std::size_t channels : {10u, 100u, 1000u}) {
+        print_row("coroutine", channels, run_coroutines(channels, per_channel));
+        print_row("thread", channels, run_threads(channels, per_channel));
+    }
+
+    return 0;
+}
@@ -0,0 +1,205 @@
+// Google Benchmark suite for the hot-path primitives.
+//
+// Usage: microbench --benchmark_out=micro.json --benchmark_out_format=json
+//        microbench --benchmark_filter=TwoThread
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include "latency_tracker.h"
+#include "ring_buffer.h"
+
+namespace {
+
+// Fixed-size ring element; seq keeps the copy observable
+template <std::size_t Bytes>
+struct Payload {
+    static_assert(Bytes >= sizeof(std::uint64_t));
+
+    std::uint64_t seq{0};
+    std::array<std::byte, Bytes - sizeof(std::uint64_t)> pad{};
+};
+
+// ---- SpscRingBuffer, single thread ----
+
+template <std::size_t Bytes>
+void BM_RingPushPop(benchmark::State& state) {
+    SpscRingBuffer<Payload<Bytes>> rb(1024);
+    Payload<Bytes> in{};
+    Payload<Bytes> out{};
+
+    for (auto _ : state) {
+        rb.try_push(in);
+        rb.try_pop(out);
+        benchmark::DoNotOptimize(out);
+        ++in.seq;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_RingPushPop, 8);
+BENCHMARK_TEMPLATE(BM_RingPushPop, 16);
+BENCHMARK_TEMPLATE(BM_RingPushPop, 32);
+BENCHMARK_TEMPLATE(BM_RingPushPop, 64);
+BENCHMARK_TEMPLATE(BM_RingPushPop, 128);
+BENCHMARK_TEMPLATE(BM_RingPushPop, 256);
+
+void BM_RingPopEmpty(benchmark::State& state) {
+    SpscRingBuffer<std::uint64_t> rb(1024);
+    std::uint64_t out = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rb.try_pop(out));
+    }
+}
+BENCHMARK(BM_RingPopEmpty);
+
+void BM_RingPushFull(benchmark::State& state) {
+    SpscRingBuffer<std::uint64_t> rb(2);
+    while (rb.try_push(0)) {}
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rb.try_push(1));
+    }
+}
+BENCHMARK(BM_RingPushFull);
+
+// ---- SpscRingBuffer, producer (benchmark thread) -> consumer thread, one-way throughput ----
+
+template <std::size_t Bytes>
+void BM_RingStream(benchmark::State& state) {
+    constexpr std::uint64_t kBatch = 4096;      // events pushed per benchmark iteration
+
+    SpscRingBuffer<Payload<Bytes>> rb(static_cast<std::size_t>(state.range(0)));
+    std::atomic<bool> done{false};
+    std::uint64_t consumed = 0;
+
+    std::thread consumer([&] {
+        Payload<Bytes> out{};
+        std::uint64_t n = 0;
+        while (!done.load(std::memory_order_acquire) || !rb.empty()) {
+            if (rb.try_pop(out)) {
+                ++n;
+            }
+        }
+        consumed = n;
+    });
+
+    Payload<Bytes> in{};
+    for (auto _ : state) {
+        for (std::uint64_t i = 0; i < kBatch;) {
+            if (rb.try_push(in)) {
+                ++in.seq;
+                ++i;
+            }
+        }
+    }
+
+    done.store(true, std::memory_order_release);
+    consumer.join();
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(consumed));
+    state.SetBytesProcessed(static_cast<std::int64_t>(consumed * Bytes));
+}
+BENCHMARK_TEMPLATE(BM_RingStream, 8)->RangeMultiplier(16)->Range(64, 1 << 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingStream, 64)->RangeMultiplier(16)->Range(64, 1 << 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingStream, 256)->RangeMultiplier(16)->Range(64, 1 << 16)->UseRealTime();
+
+// ---- SpscRingBuffer ping-pong: push, wait for the echo on a second ring (one round trip per op) ----
+
+template <std::size_t Bytes>
+void BM_RingPingPong(benchmark::State& state) {
+    SpscRingBuffer<Payload<Bytes>> ping(64);
+    SpscRingBuffer<Payload<Bytes>> pong(64);
+    std::atomic<bool> done{false};
+
+    std::thread echo([&] {
+        Payload<Bytes> msg{};
+        while (!done.load(std::memory_order_acquire)) {
+            if (ping.try_pop(msg)) {
+                while (!pong.try_push(msg)) {}
+            }
+        }
+    });
+
+    Payload<Bytes> in{};
+    Payload<Bytes> out{};
+    for (auto _ : state) {
+        while (!ping.try_push(in)) {}
+        while (!pong.try_pop(out)) {}
+        ++in.seq;
+    }
+    benchmark::DoNotOptimize(out);
+
+    done.store(true, std::memory_order_release);
+    echo.join();
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_RingPingPong, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingPingPong, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingPingPong, 256)->UseRealTime();
+
+// ---- LatencyTracker ----
+
+void BM_LatencyRecord(benchmark::State& state) {
+    spsc::LatencyTracker lt(1 << 20);
+    std::uint64_t v = 0;
+
+    for (auto _ : state) {
+        lt.record_ns(v);
+        v = (v + 97) & 0xFFFF;
+    }
+
+    benchmark::DoNotOptimize(lt.count());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LatencyRecord);
+
+void BM_LatencyCompute(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    spsc::LatencyTracker lt(n);
+
+    // Pseudo-random spread so the sort does real work
+    std::uint64_t x = 88172645463325252ull;
+    for (std::size_t i = 0; i < n; ++i) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        lt.record_ns(x % 100'000);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lt.compute());
+    }
+
+    state.SetComplexityN(state.range(0));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LatencyCompute)->RangeMultiplier(8)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond)->Complexity(benchmark::oNLogN);
+
+// ---- Clock ----
+
+void BM_NowNs(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(spsc::LatencyTracker::now_ns());
+    }
+}
+BENCHMARK(BM_NowNs);
+
+void BM_SteadyClockNow(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::chrono::steady_clock::now());
+    }
+}
+BENCHMARK(BM_SteadyClockNow);
+
+}//namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,136 @@
+// Trade latency during quote storms: one FIFO ring vs. priority lanes (trades and heartbeats in
+// lane 0, quotes in lane 1). Steady phase is paced; every burst_every events a burst of
+// burst_len quote-heavy events is pushed unpaced. The consumer does quote_work_ns of busy work
+// per quote, so a burst builds a backlog that trades either queue behind or jump.
+//
+// Usage: lanes_bench [events] [gap_ns] [burst_every] [burst_len] [quote_work_ns] [starvation_limit]
+
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+
+#include "lane_bus.h"
+#include "latency_tracker.h"
+
+namespace {
+
+constexpr std::size_t kMaxSamples = 1 << 20;
+
+// Consumer work: spin on quotes, split trade latency by the phase the trade was produced in
+struct TradeLatencyHandler {
+    spsc::LaneWorkload workload{};
+    std::uint64_t quote_work_ns{0};
+
+    std::unique_ptr<spsc::LatencyTracker> burst{std::make_unique<spsc::LatencyTracker>(kMaxSamples)};
+    std::unique_ptr<spsc::LatencyTracker> steady{std::make_unique<spsc::LatencyTracker>(kMaxSamples)};
+
+    void operator()(const spsc::Event& e, std::uint64_t now) noexcept {
+        if (e.type == spsc::EventType::Quote) {
+            const std::uint64_t until = now + quote_work_ns;
+            while (spsc::SteadyClock::now_ns() < until) spsc::cpu_relax();
+            return;
+        }
+        if (e.type == spsc::EventType::Trade) {
+            (workload.in_burst(e.seq) ? burst : steady)->record_ns(now - e.enqueue_ns);
+        }
+    }
+};
+
+struct Result {
+    spsc::LatencyTracker::Stats trade_burst{};
+    spsc::LatencyTracker::Stats trade_steady{};
+    spsc::LatencyTracker::Stats quotes{};
+    std::uint64_t starved_polls{0};
+    std::uint64_t max_starved_streak{0};
+    std::uint64_t seq_mismatch{0};
+};
+
+Result run(const spsc::LaneBusOptions& opts, std::uint64_t events, std::uint64_t quote_work_ns) {
+    spsc::PriorityLaneBus<TradeLatencyHandler> bus(opts, TradeLatencyHandler{opts.workload, quote_work_ns});
+    bus.handler().burst->prefault();
+    bus.handler().steady->prefault();
+    bus.launch();                                   // thread creation and prefault stay out of the run
+
+    bus.start(events);
+    bus.join();
+
+    Result r{};
+    r.trade_burst = bus.handler().burst->compute();
+    r.trade_steady = bus.handler().steady->compute();
+    r.seq_mismatch = bus.counters().seq_mismatch;
+
+    // Quotes share lane 0 with trades in the single-lane run
+    const std::size_t quote_lane = bus.lane_of(spsc::EventType::Quote);
+    if (quote_lane != 0) {
+        const auto s = bus.lane_stats(quote_lane);
+        r.quotes = s.latency;
+        r.starved_polls = s.starved_polls;
+        r.max_starved_streak = s.max_starved_streak;
+    }
+    return r;
+}
+
+void row(const char* name, const char* phase, const spsc::LatencyTracker::Stats& s) {
+    std::cout << "  " << std::left << std::setw(14) << name << std::setw(14) << phase << std::right
+              << std::setw(10) << s.count
+              << std::setw(12) << s.p50_ns
+              << std::setw(12) << s.p99_ns
+              << std::setw(12) << s.p999_ns
+              << std::setw(12) << s.max_ns << "\n";
+}
+
+}//namespace
+
+
+int main(int argc, char** argv) {
+    const std::uint64_t events = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 2'000'000;
+    const std::uint64_t gap_ns = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 500;
+    const std::uint64_t burst_every = (argc > 3) ? std::strtoull(argv[3], nullptr, 10) : 200'000;
+    const std::uint64_t burst_len = (argc > 4) ? std::strtoull(argv[4], nullptr, 10) : 20'000;
+    const std::uint64_t quote_work_ns = (argc > 5) ? std::strtoull(argv[5], nullptr, 10) : 100;
+    const std::uint64_t starvation = (argc > 6) ? std::strtoull(argv[6], nullptr, 10) : 64;
+
+    spsc::LaneBusOptions opts{};
+    opts.lane_capacity = 1 << 15;                   // holds a whole burst: measure queueing, not backpressure
+    opts.max_latency_samples = kMaxSamples;
+    opts.memory = spsc::MemoryPolicy::Prefault;
+    opts.starvation_limit = starvation;
+    opts.workload.gap_ns = gap_ns;
+    opts.workload.burst_every = burst_every;
+    opts.workload.burst_len = burst_len;
+
+    spsc::LaneBusOptions fifo = opts;
+    fifo.lane_of = {0, 0, 0};
+
+    std::cout << "Events " << events << ", gap " << gap_ns << " ns, burst " << burst_len << " every "
+              << burst_every << ", quote work " << quote_work_ns << " ns, starvation limit " << starvation << "\n";
+    std::cout << "  " << std::left << std::setw(14) << "bus" << std::setw(14) << "latency" << std::right
+              << std::setw(10) << "count" << std::setw(12) << "p50" << std::setw(12) << "p99"
+              << std::setw(12) << "p999" << std::setw(12) << "max" << "\n";
+
+    const Result single = run(fifo, events, quote_work_ns);
+    const Result lanes = run(opts, events, quote_work_ns);
+
+    row("single ring", "trade/burst", single.trade_burst);
+    row("single ring", "trade/steady", single.trade_steady);
+    row("lanes", "trade/burst", lanes.trade_burst);
+    row("lanes", "trade/steady", lanes.trade_steady);
+    row("lanes", "quote", lanes.quotes);
+
+    std::cout << "  quote lane: " << lanes.starved_polls << " starved polls, max streak "
+              << lanes.max_starved_streak << "\n";
+    if (lanes.trade_burst.p99_ns != 0) {
+        std::cout << "  burst trade p99, single / lanes: " << std::fixed << std::setprecision(2)
+                  << static_cast<double>(single.trade_burst.p99_ns) / static_cast<double>(lanes.trade_burst.p99_ns)
+                  << "\n";
+    }
+
+    if (single.seq_mismatch != 0 || lanes.seq_mismatch != 0) {
+        std::cerr << "seq mismatches: " << single.seq_mismatch << " / " << lanes.seq_mismatch << "\n";
+        return 1;
+    }
+    return 0;
+}
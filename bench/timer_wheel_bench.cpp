@@ -0,0 +1,149 @@
+// Consumer-loop cost of the timer wheel with 100K active timers: the per-event work EventBus's
+// consumer does (record latency) with and without FeedMonitor::on_event + TimerWheel::advance,
+// plus raw schedule / cancel / expiry cost.
+//
+// Usage: timer_bench [events]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+
+#include "feed_monitor.h"
+#include "latency_tracker.h"
+#include "timer_wheel.h"
+
+namespace {
+
+constexpr std::size_t kInstruments = 100'000;
+constexpr std::uint64_t kEventGapNs = 50;               // ~20M events/s feed
+constexpr std::uint64_t kStaleAfterNs = 50'000'000;     // 50ms
+constexpr std::uint64_t kHeartbeatNs = 1'000'000;       // 1ms
+
+double secs_since(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+void row(const char* name, double secs, std::uint64_t n, const char* extra = "") {
+    std::cout << "  " << std::left << std::setw(34) << name << std::right
+              << std::setw(10) << std::fixed << std::setprecision(2) << (secs * 1e9 / static_cast<double>(n))
+              << " ns/op" << extra << "\n";
+}
+
+std::vector<std::uint32_t> make_ids(std::uint64_t n) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::uint32_t> dist(0, kInstruments - 1);
+    std::vector<std::uint32_t> ids(n);
+    for (auto& id : ids) id = dist(rng);
+    return ids;
+}
+
+// Same synthetic timestamps for both loops; the wheel never reads a clock
+void consumer_loop(const std::vector<std::uint32_t>& ids, std::uint64_t events) {
+    spsc::LatencyTracker base_tracker(events);
+    std::uint64_t now = 1'000'000;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::uint64_t i = 0; i < events; ++i) {
+        now += kEventGapNs;
+        base_tracker.record_ns(200 + (ids[i] & 7));
+    }
+    const double base = secs_since(t0);
+
+    spsc::LatencyTracker tracker(events);
+    spsc::TimerWheel wheel(kInstruments + 1, 0);
+    spsc::FeedMonitor feed(wheel, kInstruments, kStaleAfterNs, kHeartbeatNs);
+
+    // Arm every instrument up front so the wheel holds 100K live timers throughout
+    now = 1'000'000;
+    wheel.reset(now);
+    feed.start();
+    for (std::uint32_t id = 0; id < kInstruments; ++id) feed.on_event(id, now);
+    const std::size_t armed = wheel.active();
+
+    t0 = std::chrono::steady_clock::now();
+    for (std::uint64_t i = 0; i < events; ++i) {
+        now += kEventGapNs;
+        tracker.record_ns(200 + (ids[i] & 7));
+        feed.on_event(ids[i], now);
+        wheel.advance(now);
+    }
+    const double with = secs_since(t0);
+
+    std::cout << "Consumer loop, " << events << " events, " << armed << " timers armed ("
+              << (static_cast<double>(events * kEventGapNs) / 1e6) << "ms simulated)\n";
+    row("record only", base, events);
+    row("record + on_event + advance", with, events);
+    std::cout << "  overhead per event: " << std::setprecision(2)
+              << ((with - base) * 1e9 / static_cast<double>(events)) << " ns"
+              << "  (heartbeats " << feed.heartbeats() << ", stale " << feed.stale_events()
+              << ", active " << wheel.active() << ")\n";
+}
+
+void noop(void*, std::uint64_t, std::uint64_t) {}
+
+void count_cb(void* ctx, std::uint64_t, std::uint64_t) { ++*static_cast<std::uint64_t*>(ctx); }
+
+void schedule_cancel(std::uint64_t ops) {
+    spsc::TimerWheel wheel(kInstruments + 1, 0);
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<std::uint64_t> delay(1'000, 10'000'000'000ull);   // 1us .. 10s
+
+    std::vector<spsc::TimerWheel::TimerId> ids(kInstruments);
+    for (auto& id : ids) id = wheel.schedule_after(delay(rng), noop, nullptr);
+
+    // Steady state at 100K: cancel a random live timer, schedule a replacement
+    std::uniform_int_distribution<std::size_t> pick(0, kInstruments - 1);
+    std::vector<std::size_t> slots(ops);
+    std::vector<std::uint64_t> delays(ops);
+    for (std::uint64_t i = 0; i < ops; ++i) { slots[i] = pick(rng); delays[i] = delay(rng); }
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (std::uint64_t i = 0; i < ops; ++i) {
+        auto& id = ids[slots[i]];
+        wheel.cancel(id);
+        id = wheel.schedule_after(delays[i], noop, nullptr);
+    }
+    const double secs = secs_since(t0);
+
+    std::cout << "Schedule/cancel with " << wheel.active() << " active timers\n";
+    row("cancel + schedule", secs, ops);
+}
+
+void expiry() {
+    spsc::TimerWheel wheel(kInstruments + 1, 0);
+    std::mt19937_64 rng(9);
+    std::uniform_int_distribution<std::uint64_t> delay(1'000, 1'000'000'000ull);    // 1us .. 1s
+
+    std::uint64_t fired = 0;
+    for (std::size_t i = 0; i < kInstruments; ++i) wheel.schedule_after(delay(rng), count_cb, &fired);
+
+    // Walk time forward in 1us steps, as a busy consumer would
+    const auto t0 = std::chrono::steady_clock::now();
+    std::uint64_t steps = 0;
+    for (std::uint64_t now = 0; wheel.active() != 0; now += 1'000, ++steps) {
+        wheel.advance(now);
+    }
+    const double secs = secs_since(t0);
+
+    std::cout << "Expire " << fired << " timers over 1s in 1us advance() steps\n";
+    row("per timer fired (incl. cascades)", secs, fired);
+    row("per advance() call", secs, steps);
+}
+
+}//namespace
+
+
+int main(int argc, char** argv) {
+    const std::uint64_t events = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 20'000'000;
+    const auto ids = make_ids(events);
+
+    consumer_loop(ids, events);
+    schedule_cancel(events / 4);
+    expiry();
+    return 0;
+}
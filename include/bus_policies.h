@@ -0,0 +1,138 @@
+#pragma once
+
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace spsc {
+
+// Compile-time policies for BasicEventBus. Every hook is a plain (usually inline) member call on a
+// concrete type, so the thread loops compile to straight-line code: no virtuals, no std::function.
+
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+    _mm_pause();
+#endif
+}
+
+// How an idle thread waits (producer on a full ring, consumer on an empty one)
+enum class WaitStrategy : std::uint8_t {
+    Spin = 0,           // busy spin with a CPU pause hint; lowest latency, burns the core
+    SpinYield = 1,      // spin, yield every 16K failed attempts
+    Yield = 2           // yield on every failed attempt; for oversubscribed machines
+};
+
+
+// --- Concepts -------------------------------------------------------------------------------
+
+// Payload: fixed-size value carrying the bus's bookkeeping fields
+template <typename P>
+concept BusPayload = std::is_trivially_copyable_v<P> && std::default_initializable<P>
+    && requires(P p) {
+        { p.enqueue_ns } -> std::convertible_to<std::uint64_t>;
+        { p.seq } -> std::convertible_to<std::uint64_t>;
+        p.enqueue_ns = std::uint64_t{};
+        p.seq = std::uint64_t{};
+    };
+
+// Queue: single-producer / single-consumer, sized at construction (SpscRingBuffer's interface)
+template <typename Q, typename P>
+concept BusQueue = std::constructible_from<Q, std::size_t>
+    && requires(Q q, const Q cq, P p) {
+        { q.try_push(std::move(p)) } -> std::same_as<bool>;
+        { q.try_pop(p) } -> std::same_as<bool>;
+        { cq.empty() } -> std::convertible_to<bool>;
+        { cq.size() } -> std::convertible_to<std::size_t>;
+        { cq.capacity() } -> std::convertible_to<std::size_t>;
+        q.prefault();
+    };
+
+// WaitPolicy: idle(n) after the nth consecutive failed attempt. Either default-constructible
+// (fixed at compile time) or built from the runtime WaitStrategy in the bus Options.
+template <typename W>
+concept WaitPolicy = (std::default_initializable<W> || std::constructible_from<W, WaitStrategy>)
+    && requires(const W w, std::uint64_t fail_spins) {
+        { w.idle(fail_spins) } noexcept;
+    };
+
+// Clock: static monotonic nanoseconds; both threads stamp with it
+template <typename C>
+concept BusClock = requires {
+    { C::now_ns() } noexcept -> std::same_as<std::uint64_t>;
+};
+
+// Handler: called on the consumer thread for every event, after the bus's own bookkeeping
+template <typename H, typename P>
+concept BusHandler = std::move_constructible<H> && std::invocable<H&, const P&, std::uint64_t>;
+
+
+// --- Wait policies --------------------------------------------------------------------------
+
+struct SpinWait {
+    void idle(std::uint64_t) const noexcept { cpu_relax(); }
+};
+
+struct SpinYieldWait {
+    void idle(std::uint64_t fail_spins) const noexcept {
+        if ((fail_spins & 0x3FFFu) == 0) std::this_thread::yield();
+    }
+};
+
+struct YieldWait {
+    void idle(std::uint64_t) const noexcept { std::this_thread::yield(); }
+};
+
+// Chosen per bus from Options::wait (a predictable branch per idle iteration)
+class RuntimeWait {
+public:
+    explicit RuntimeWait(WaitStrategy strategy) noexcept : strategy_(strategy) {}
+
+    void idle(std::uint64_t fail_spins) const noexcept {
+        switch (strategy_) {
+            case WaitStrategy::Spin: SpinWait{}.idle(fail_spins); break;
+            case WaitStrategy::SpinYield: SpinYieldWait{}.idle(fail_spins); break;
+            case WaitStrategy::Yield: YieldWait{}.idle(fail_spins); break;
+        }
+    }
+
+private:
+    WaitStrategy strategy_;
+};
+
+namespace detail {
+
+// A bus's wait policy from its Options::wait (only RuntimeWait takes it)
+template <typename W>
+W make_wait(WaitStrategy strategy) {
+    if constexpr (std::constructible_from<W, WaitStrategy>) return W{strategy};
+    else return W{};
+}
+
+}//namespace detail
+
+
+// --- Clocks and handlers --------------------------------------------------------------------
+
+// Same clock as LatencyTracker::now_ns(), visible to the optimiser
+struct SteadyClock {
+    static std::uint64_t now_ns() noexcept {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+};
+
+// Measure-only bus: the consumer records latency and does nothing else with the event
+struct NoopHandler {
+    template <typename P>
+    void operator()(const P&, std::uint64_t) const noexcept {}
+};
+
+}//namespace spsc
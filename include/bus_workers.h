@@ -0,0 +1,143 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "event.h"
+
+namespace spsc {
+
+// How bus memory (ring slots, latency samples) is faulted in
+enum class MemoryPolicy : std::uint8_t {
+    Lazy = 0,           // pages fault in on first use (on the hot path)
+    Prefault = 1        // worker threads touch their buffers (and stacks) at launch, after pinning
+};
+
+// What the producer / consumer pair of any bus counts (written by its threads, read after join)
+struct WorkerCounters {
+    std::uint64_t produced{0};
+    std::uint64_t consumed{0};
+    std::uint64_t push_fail_spins{0};
+    std::uint64_t pop_fail_spins{0};
+    std::uint64_t seq_mismatch{0};
+};
+
+namespace detail {
+
+// Thread setup shared by every bus (bus_workers.cpp)
+void pin_current_thread(int core) noexcept;
+void prefault_stack() noexcept;
+
+// Minimal synthetic payload (can be replaced with real market event gen later)
+inline void fill_payload(Event& e, std::uint64_t seq) noexcept {
+    e.instrument_id = static_cast<std::uint32_t>(seq & 0xFFFF);
+    e.qty = 100u + static_cast<std::uint32_t>(seq & 0x3F);
+    e.price_ticks = 100'000 + static_cast<std::int64_t>(seq % 1'000);
+    e.type = EventType::Trade;
+    e.side = (seq & 1) ? Side::Buy : Side::Sell;
+}
+
+}//namespace detail
+
+
+// The producer / consumer thread pair behind a bus. launch() spawns both once; each pins itself,
+// runs the bus's prefault step (MemoryPolicy::Prefault) and parks. start() wakes both for one run
+// of the bus's loop, join() waits until both are parked again. Threads live until shutdown().
+class BusWorkers final {
+public:
+    enum class Role : std::uint8_t { Producer, Consumer };
+
+    BusWorkers() = default;
+
+    BusWorkers(const BusWorkers&) = delete;
+    BusWorkers& operator=(const BusWorkers&) = delete;
+
+    ~BusWorkers() { shutdown(); }
+
+    // prefault(role) runs once per thread after pinning; run(role) once per start().
+    // Returns once both threads are parked; no-op if already launched.
+    template <typename Prefault, typename Run>
+    void launch(int producer_core, int consumer_core, MemoryPolicy memory, Prefault prefault, Run run);
+
+    bool launched() const noexcept { return launched_; }
+
+    // Wake the parked threads for one run; everything written before start() is visible to it
+    void start() noexcept;
+
+    // Wait until both threads finished the current run
+    void join() noexcept;
+
+    // End the threads once the current run is over. The owner calls this before destroying
+    // anything run() touches.
+    void shutdown() noexcept;
+
+private:
+    template <typename Prefault, typename Run>
+    void thread_main_(Role role, int core, MemoryPolicy memory, Prefault& prefault, Run& run);
+
+    std::thread producer_;
+    std::thread consumer_;
+
+    std::atomic<bool> shutdown_{false};
+
+    // Parked threads wake when run_gen_ changes; each bumps finished_ at the end of a run
+    std::atomic<std::uint64_t> run_gen_{0};
+    std::atomic<std::uint32_t> parked_{0};
+    std::atomic<std::uint32_t> finished_{0};
+    bool launched_{false};                      // owner thread only
+};
+
+
+template <typename Prefault, typename Run>
+void BusWorkers::launch(int producer_core, int consumer_core, MemoryPolicy memory, Prefault prefault, Run run) {
+    if (launched_) {
+        return;
+    }
+    launched_ = true;
+
+    producer_ = std::thread([this, producer_core, memory, prefault, run]() mutable {
+        thread_main_(Role::Producer, producer_core, memory, prefault, run);
+    });
+    consumer_ = std::thread([this, consumer_core, memory, prefault, run]() mutable {
+        thread_main_(Role::Consumer, consumer_core, memory, prefault, run);
+    });
+
+    // Wait until both are pinned, prefaulted and parked
+    for (auto n = parked_.load(std::memory_order_acquire); n < 2; n = parked_.load(std::memory_order_acquire)) {
+        parked_.wait(n, std::memory_order_acquire);
+    }
+}
+
+template <typename Prefault, typename Run>
+void BusWorkers::thread_main_(Role role, int core, MemoryPolicy memory, Prefault& prefault, Run& run) {
+    detail::pin_current_thread(core);
+
+    if (memory == MemoryPolicy::Prefault) {
+        // First touch from the (pinned) thread that writes the memory
+        prefault(role);
+        detail::prefault_stack();
+    }
+
+    // Read before parking: start() can only bump it once both threads are parked
+    std::uint64_t seen = run_gen_.load(std::memory_order_acquire);
+
+    parked_.fetch_add(1, std::memory_order_release);
+    parked_.notify_all();
+
+    for (;;) {
+        run_gen_.wait(seen, std::memory_order_acquire);
+        seen = run_gen_.load(std::memory_order_acquire);
+
+        if (shutdown_.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        run(role);
+
+        finished_.fetch_add(1, std::memory_order_release);
+        finished_.notify_all();
+    }
+}
+
+}//namespace spsc
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "ring_buffer.h"
+
+namespace spsc {
+
+// Fixed-block free-list allocator for coroutine frames.
+// One pool per thread: frames must be created and destroyed on the thread that runs the scheduler.
+// Blocks are only allocated when the pool grows (coroutine creation); resuming never allocates.
+class FramePool final {
+public:
+    static constexpr std::size_t kBlockSize = 512;          // max frame size served from the pool
+    static constexpr std::size_t kBlocksPerChunk = 256;     // growth step
+
+    static FramePool& local() noexcept {
+        thread_local FramePool pool;
+        return pool;
+    }
+
+    FramePool() = default;
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    // Pre-grow so that `blocks` frames can be created without touching the heap
+    void reserve(std::size_t blocks);
+
+    void* allocate(std::size_t n);
+    void deallocate(void* p, std::size_t n) noexcept;
+
+    std::size_t capacity() const noexcept { return blocks_; }
+    std::size_t in_use() const noexcept { return in_use_; }
+
+    // Frames larger than kBlockSize fall back to ::operator new (should stay 0)
+    std::size_t oversized() const noexcept { return oversized_; }
+
+private:
+    struct FreeNode { FreeNode* next; };
+
+    void grow_(std::size_t blocks);
+
+    std::vector<std::unique_ptr<std::byte[]>> chunks_;
+    FreeNode* free_{nullptr};
+
+    std::size_t blocks_{0};
+    std::size_t in_use_{0};
+    std::size_t oversized_{0};
+};
+
+
+// Coroutine handle owner. Starts suspended; a PollScheduler drives it.
+class Task final {
+public:
+    struct promise_type {
+        Task get_return_object() noexcept {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+
+        static void* operator new(std::size_t n) { return FramePool::local().allocate(n); }
+        static void operator delete(void* p, std::size_t n) noexcept { FramePool::local().deallocate(p, n); }
+    };
+
+    Task() noexcept = default;
+    Task(Task&& other) noexcept : h_(std::exchange(other.h_, {})) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (h_) h_.destroy();
+            h_ = std::exchange(other.h_, {});
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() { if (h_) h_.destroy(); }
+
+    bool done() const noexcept { return !h_ || h_.done(); }
+    std::coroutine_handle<> handle() const noexcept { return h_; }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> h) noexcept : h_(h) {}
+
+    std::coroutine_handle<promise_type> h_{};
+};
+
+
+// Single-threaded polling scheduler: resumes coroutines whose source (ring) has data.
+// Waiters are intrusive nodes living in the suspended coroutine frames, so poll() never allocates.
+// A queued waiter unlinks itself when its frame is destroyed (see cancel), so a parked Task can
+// be dropped at any time. The scheduler must outlive the channels' awaiters only while they wait.
+class PollScheduler final {
+public:
+    struct Waiter;
+
+    // Intrusive doubly-linked list: O(1) append, pop and unlink from anywhere
+    class WaitList {
+    public:
+        void push_back(Waiter* w) noexcept;
+        Waiter* pop_front() noexcept;
+        void remove(Waiter* w) noexcept;
+
+        // Move every node of `other` to the back of this list
+        void splice(WaitList& other) noexcept;
+
+        // Unlink everything without touching the owners (scheduler teardown)
+        void clear() noexcept;
+
+        std::size_t size() const noexcept { return size_; }
+
+    private:
+        Waiter* head_{nullptr};
+        Waiter* tail_{nullptr};
+        std::size_t size_{0};
+    };
+
+    struct Waiter {
+        bool (*ready)(const void* source) noexcept{nullptr};
+        const void* source{nullptr};
+        std::coroutine_handle<> handle{};
+        Waiter* prev{nullptr};
+        Waiter* next{nullptr};
+        WaitList* list{nullptr};        // non-null while queued
+    };
+
+    PollScheduler() = default;
+    PollScheduler(const PollScheduler&) = delete;
+    PollScheduler& operator=(const PollScheduler&) = delete;
+
+    ~PollScheduler();
+
+    // Run the task until its first suspension point
+    void spawn(Task& task);
+
+    // One pass over the wait list. Returns the number of coroutines resumed.
+    std::size_t poll() noexcept;
+
+    // Called by awaiters on suspension
+    void enqueue(Waiter* w) noexcept;
+
+    // Called by awaiters on destruction: unlink w if it is still queued (no-op otherwise)
+    static void cancel(Waiter& w) noexcept {
+        if (w.list != nullptr) w.list->remove(&w);
+    }
+
+    std::size_t waiting() const noexcept { return queue_.size() + polling_.size(); }
+
+private:
+    WaitList queue_;
+    WaitList polling_;          // the pass poll() is working through
+};
+
+
+// Awaitable consumer view over an SpscRingBuffer. The scheduler thread is the ring's single consumer.
+template <typename T>
+    requires std::default_initializable<T>
+class Channel final {
+public:
+    Channel(SpscRingBuffer<T>& rb, PollScheduler& sched) noexcept : rb_(&rb), sched_(&sched) {}
+
+    class NextAwaiter {
+    public:
+        explicit NextAwaiter(Channel& ch) noexcept : ch_(ch) {}
+
+        // Destroying a parked Task destroys this awaiter: take the waiter out of the scheduler
+        ~NextAwaiter() { PollScheduler::cancel(waiter_); }
+
+        bool await_ready() { return have_ = ch_.rb_->try_pop(value_); }
+
+        void await_suspend(std::coroutine_handle<> h) noexcept {
+            waiter_.ready = &Channel::ready_;
+            waiter_.source = ch_.rb_;
+            waiter_.handle = h;
+            ch_.sched_->enqueue(&waiter_);
+        }
+
+        T await_resume() {
+            // Scheduler only resumes us when the ring is non-empty; we are the only consumer
+            if (!have_) ch_.rb_->try_pop(value_);
+            return std::move(value_);
+        }
+
+    private:
+        Channel& ch_;
+        PollScheduler::Waiter waiter_{};
+        T value_{};
+        bool have_{false};
+    };
+
+    class BatchAwaiter {
+    public:
+        BatchAwaiter(Channel& ch, T* out, std::size_t max) noexcept : ch_(ch), out_(out), max_(max) {}
+
+        ~BatchAwaiter() { PollScheduler::cancel(waiter_); }
+
+        bool await_ready() { return (n_ = ch_.drain_(out_, max_)) != 0; }
+
+        void await_suspend(std::coroutine_handle<> h) noexcept {
+            waiter_.ready = &Channel::ready_;
+            waiter_.source = ch_.rb_;
+            waiter_.handle = h;
+            ch_.sched_->enqueue(&waiter_);
+        }
+
+        std::size_t await_resume() {
+            if (n_ == 0) n_ = ch_.drain_(out_, max_);
+            return n_;
+        }
+
+    private:
+        Channel& ch_;
+        PollScheduler::Waiter waiter_{};
+        T* out_;
+        std::size_t max_;
+        std::size_t n_{0};
+    };
+
+    // co_await ch.next() -> next value (suspends while the ring is empty)
+    NextAwaiter next() noexcept { return NextAwaiter{*this}; }
+
+    // co_await ch.next_batch(out, max) -> number of values written to out (1..max)
+    BatchAwaiter next_batch(T* out, std::size_t max) noexcept { return BatchAwaiter{*this, out, max}; }
+
+private:
+    static bool ready_(const void* source) noexcept {
+        return !static_cast<const SpscRingBuffer<T>*>(source)->empty();
+    }
+
+    std::size_t drain_(T* out, std::size_t max) {
+        std::size_t n = 0;
+        while (n < max && rb_->try_pop(out[n])) ++n;
+        return n;
+    }
+
+    SpscRingBuffer<T>* rb_;
+    PollScheduler* sched_;
+};
+
+}//namespace spsc
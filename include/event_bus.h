@@ -1,89 +1,773 @@
-#pragma once 
+#pragma once
 
-#include <atomic> 
-#include <cstddef> 
-#include <cstdint> 
-#include <thread> 
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 
+#include "bus_policies.h"
+#include "bus_workers.h"
 #include "event.h"
+#include "feed_monitor.h"
 #include "latency_tracker.h"
+#include "outlier_recorder.h"
 #include "ring_buffer.h"
+#include "timer_wheel.h"
+#include "trace.h"
+
+// UDP feed ingest producer (Linux only: recvmmsg, SO_TIMESTAMPNS). The build sets SPSC_UDP_INGEST=1
+// on targets that want it; without it the bus has no socket code and no udp_* options.
+#ifndef SPSC_UDP_INGEST
+#define SPSC_UDP_INGEST 0
+#endif
+
+#if SPSC_UDP_INGEST
+#include "udp_ingest.h"
+#endif
 
 namespace spsc {
 
-class EventBus final {
-public: 
-    struct Counters {
-        std::uint64_t produced{0}; 
-        std::uint64_t consumed{0}; 
-        std::uint64_t push_fail_spins{0};
-        std::uint64_t pop_fail_spins{0}; 
-        std::uint64_t seq_mismatch{0}; 
-    };
+// Counters every BasicEventBus keeps, whatever its payload
+struct BusCounters : WorkerCounters {
+    std::uint64_t round_trips{0};
+};
+
+// Payload = Event: feed timer and UDP ingest counters on top (see EventBusOptions)
+struct EventBusCounters : BusCounters {
+    std::uint64_t heartbeats{0};
+    std::uint64_t stale_events{0};
+
+#if SPSC_UDP_INGEST
+    std::uint64_t packets{0};
+    std::uint64_t bad_packets{0};           // short / truncated / foreign datagrams
+    std::uint64_t packet_gaps{0};           // packets missing from the sender's sequence
+    std::uint64_t rx_empty_polls{0};
+#endif
+};
+
+// Settings every BasicEventBus understands, whatever its payload
+struct BusOptions {
+    std::size_t ring_capacity{1 << 16};
+    std::size_t max_latency_samples{1 << 20};
+
+    int producer_core{-1};          // -1 = no pinning
+    int consumer_core{-1};
+
+    WaitStrategy wait{WaitStrategy::SpinYield};     // used by RuntimeWait only
+    MemoryPolicy memory{MemoryPolicy::Lazy};
+
+    // Per-hop tracing (only with SPSC_TRACING): every Nth seq is stamped at each hop
+    // (rounded up to a power of two, 0 = off); trace_capacity spans/samples kept per thread
+    std::uint64_t trace_sample_every{1024};
+    std::size_t trace_capacity{1 << 16};
+
+    // Round-trip mode: the consumer echoes every event on a reply ring and the producer
+    // measures RTT with its own clock. in_flight caps unanswered events (<= ring capacity);
+    // think_ns is the pause after each reply before the producer sends again.
+    bool round_trip{false};
+    std::size_t in_flight{1};
+    std::uint64_t think_ns{0};
+};
+
+// Payload = Event: the market-data features on top of the generic bus. Other payloads get plain
+// BusOptions, so asking them for outliers, feed timers or UDP ingest does not compile.
+struct EventBusOptions : BusOptions {
+    // Outlier capture on the consumer path (see OutlierRecorder); 0 disables each part
+    std::size_t outlier_top_k{32};
+    std::uint64_t outlier_threshold_ns{0};
+    std::size_t outlier_threshold_capacity{1024};
+
+    // Consumer-loop timers (TimerWheel + FeedMonitor), advanced from the dequeue timestamps.
+    // Both 0 = no wheel. Instruments with no event for stale_after_ns are reported stale.
+    std::uint64_t heartbeat_every_ns{0};
+    std::uint64_t stale_after_ns{0};
+    std::size_t max_instruments{1 << 16};
+    FeedMonitor::Hooks feed_hooks{};
+
+#if SPSC_UDP_INGEST
+    // UDP ingest: with udp_listen = "host:port" (multicast hosts are joined) the producer thread
+    // receives wire packets in recvmmsg batches of udp_batch and pushes the decoded events instead
+    // of generating them; latency is then wire-to-dequeue. Takes precedence over round_trip.
+    std::string udp_listen{};
+    std::size_t udp_batch{32};
+#endif
+};
+
+// ring covers every event; produce/handle cover traced samples (empty without SPSC_TRACING)
+struct EventBusHopStats {
+    LatencyTracker::Stats produce{};
+    LatencyTracker::Stats ring{};
+    LatencyTracker::Stats handle{};
+};
+
+namespace detail {
+
+// State behind the market-data features of a bus. Empty unless Payload = Event.
+template <typename Payload>
+struct EventFeatures {
+    EventFeatures(const BusOptions&, std::uint64_t) noexcept {}
+};
+
+template <typename Payload>
+    requires std::same_as<Payload, Event>
+struct EventFeatures<Payload> {
+    EventFeatures(const EventBusOptions& opts, std::uint64_t now_ns)
+        : outliers(opts.outlier_top_k, opts.outlier_threshold_ns, opts.outlier_threshold_capacity) {
+
+        if (opts.heartbeat_every_ns != 0 || opts.stale_after_ns != 0) {
+            // One stale timer per instrument + the heartbeat
+            timers = std::make_unique<TimerWheel>(opts.max_instruments + 1, now_ns);
+            feed = std::make_unique<FeedMonitor>(*timers, opts.max_instruments,
+                                                 opts.stale_after_ns, opts.heartbeat_every_ns, opts.feed_hooks);
+        }
+
+#if SPSC_UDP_INGEST
+        if (!opts.udp_listen.empty()) {
+            udp = std::make_unique<UdpIngest>(opts.udp_listen, opts.udp_batch);
+        }
+#endif
+    }
+
+    OutlierRecorder outliers;                           // consumer thread only
+    std::unique_ptr<TimerWheel> timers;                 // consumer thread only (null when unused)
+    std::unique_ptr<FeedMonitor> feed;
+
+#if SPSC_UDP_INGEST
+    std::unique_ptr<UdpIngest> udp;                     // producer thread only (null when unused)
+
+    // Producer thread only
+    std::uint64_t packets{0};
+    std::uint64_t bad_packets{0};
+    std::uint64_t packet_gaps{0};
+    std::uint64_t rx_empty_polls{0};
+    std::uint64_t next_packet_seq{0};                   // kept across runs: the sender doesn't restart
+    bool seen_packet{false};
+#endif
+};
+
+}//namespace detail
+
+
+// One producer thread, one consumer thread, one queue, assembled from compile-time policies:
+//   Payload  what travels through the queue (needs seq + enqueue_ns)
+//   Queue    SPSC queue of Payload
+//   Wait     idle behaviour of both threads
+//   Clock    timestamps for latency, timers and round trips
+//   Handler  per-event work on the consumer, called as handler(payload, dequeue_ns)
+// Every policy call is direct, so the loops inline down to the queue's loads and stores.
+// Market-data features (outliers, feed timers, UDP ingest, synthetic payload fields) exist only
+// for Payload = Event: their options, state, counters and accessors are compiled out for other payloads.
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+class BasicEventBus final {
+public:
+    static constexpr bool kEventPayload = std::same_as<Payload, Event>;
+
+    using Counters = std::conditional_t<kEventPayload, EventBusCounters, BusCounters>;
+    using Options = std::conditional_t<kEventPayload, EventBusOptions, BusOptions>;
+    using HopStats = EventBusHopStats;
 
     // ring_capacity: capacity for SPSC ring buffer (rounded up internally by SpscRingBuffer)
-    // max_latency_samples: how many latency samples LatencyTracker keeps (ring semantics) 
-    explicit EventBus(std::size_t ring_capacity, std::size_t max_latency_samples); 
-    
-    EventBus(const EventBus&) = delete; 
-    EventBus& operator=(const EventBus&) = delete; 
+    // max_latency_samples: how many latency samples LatencyTracker keeps (ring semantics)
+    explicit BasicEventBus(std::size_t ring_capacity, std::size_t max_latency_samples);
+
+    explicit BasicEventBus(const Options& opts, Handler handler = Handler{});
+
+    BasicEventBus(const BasicEventBus&) = delete;
+    BasicEventBus& operator=(const BasicEventBus&) = delete;
 
-    ~EventBus(); 
+    ~BasicEventBus();
 
 
-    // Start producer/consumer threads. 
+    // Spawn the producer/consumer threads (pinned, prefaulted per Options) and park them.
+    // Returns once both are parked. Threads stay alive across start/join cycles until destruction.
+    // Called by start() if needed; call it up front to keep thread creation out of the first run.
+    void launch();
+
+    // Start a run on the parked producer/consumer threads.
     // If target_events > 0, producer will stop after producing exactly that many events.
     void start(std::uint64_t target_events = 0);
 
-    // Request stop (producer stops producing; consumer drains remaining events). 
-    void stop() noexcept; 
+    // Request stop (producer stops producing; consumer drains remaining events).
+    void stop() noexcept;
 
-    // Join threads (safe to call multiple times).
-    void join(); 
+    // Wait for the current run to finish; threads park again (safe to call multiple times).
+    void join();
 
-    // Convenience: stop + join. 
-    void stop_and_join() noexcept; 
+    // Convenience: stop + join.
+    void stop_and_join() noexcept;
 
     // Offline stats (call after join for stable results).
-    LatencyTracker::Stats latency_stats() const; 
+    LatencyTracker::Stats latency_stats() const;
+
+    HopStats hop_stats() const;
+
+    // Round-trip mode only (count == 0 otherwise): RTT / 2 per event, measured on the producer,
+    // to compare against latency_stats() (one-way, stamped and read on different cores).
+    LatencyTracker::Stats rtt_half_stats() const;
+
+    // Slowest events with context. Offline accessors after join; request_snapshot/take_snapshot
+    // can be used from any thread while running.
+    OutlierRecorder& outliers() noexcept requires kEventPayload { return md_.outliers; }
+    const OutlierRecorder& outliers() const noexcept requires kEventPayload { return md_.outliers; }
 
+#if SPSC_UDP_INGEST
+    // The bus's UDP receiver (null unless udp_listen is set), e.g. for the bound port
+    const UdpIngest* ingest() const noexcept requires kEventPayload { return md_.udp.get(); }
+#endif
 
-    Counters counters() const noexcept; 
+    // The consumer's handler; only touch it while no run is in progress
+    Handler& handler() noexcept { return handler_; }
+    const Handler& handler() const noexcept { return handler_; }
 
+    // Append this bus's sampled spans as Chrome trace events (no-op without SPSC_TRACING). After join.
+    void write_trace(ChromeTraceWriter& writer, std::uint32_t pid, const char* name) const;
 
-    bool running() const noexcept { return running_.load(std::memory_order_acquire); } 
+
+    Counters counters() const noexcept;
+
+
+    bool running() const noexcept { return running_.load(std::memory_order_acquire); }
+
+    const Options& options() const noexcept { return opts_; }
 
 private:
-   void producer_loop_(std::uint64_t target_events); 
-   void consumer_loop_(); 
+   using Role = BusWorkers::Role;
+
+   static Options sized_options_(std::size_t ring_capacity, std::size_t max_latency_samples);
+
+   void prefault_(Role role);
+   void run_(Role role);
+   void producer_loop_(std::uint64_t target_events);
+   void round_trip_loop_(std::uint64_t target_events);
+#if SPSC_UDP_INGEST
+   void ingest_loop_(std::uint64_t target_events);
+#endif
+   void consumer_loop_();
+
+   // The producer reads a UDP feed instead of generating events
+   bool ingests_() const noexcept {
+#if SPSC_UDP_INGEST
+       if constexpr (kEventPayload) return md_.udp != nullptr;
+#endif
+       return false;
+   }
 
+   const Options opts_;
+
+   // Policies
+   [[no_unique_address]] Wait wait_;
+   [[no_unique_address]] Handler handler_;              // consumer thread only
 
    // Infrastructure
-   SpscRingBuffer<Event> rb_; 
-   LatencyTracker latency_; 
+   Queue rb_;
+   LatencyTracker latency_;
+   std::unique_ptr<Queue> replies_;                     // round-trip mode only: consumer -> producer
+   std::unique_ptr<LatencyTracker> rtt_half_;           // producer thread only
+   [[no_unique_address]] detail::EventFeatures<Payload> md_;
+
+#if SPSC_TRACING
+   bool tracing_{false};
+   std::uint64_t trace_mask_{0};
+
+   LatencyTracker hop_produce_;                         // producer thread only
+   TraceBuffer producer_trace_;
+   LatencyTracker hop_handle_;                          // consumer thread only
+   TraceBuffer consumer_trace_;
+#endif
 
 
    // Threads
-   std::thread producer_; 
-   std::thread consumer_; 
+   BusWorkers workers_;
 
 
    // Control
-   std::atomic<bool> stop_{false}; 
-   std::atomic<bool> running_{false}; 
+   std::atomic<bool> stop_{false};
+   std::atomic<bool> running_{false};
+   std::atomic<bool> replies_drained_{false};           // round-trip: producer saw its last reply
+   std::uint64_t target_events_{0};                     // published by workers_.start()
 
 
    // Counters (written by threads, read after join)
    alignas(64) std::uint64_t produced_{0};              // producer thread only
    alignas(64) std::uint64_t push_fail_spins_{0};       // producer thread only
+   std::uint64_t round_trips_{0};                       // producer thread only
 
    alignas(64) std::uint64_t consumed_{0};              // consumer thread only
    alignas(64) std::uint64_t pop_fail_spins_{0};        // consumer thread only
    alignas(64) std::uint64_t seq_mismatch_{0};          // consumer thread only
 
    // Expected sequence (consumer validation)
-   std::uint64_t expected_seq_{0}; 
+   std::uint64_t expected_seq_{0};
 };
 
-}//namespace spsc
\ No newline at end of file
+
+// Today's bus: market-data events on SpscRingBuffer, wait strategy chosen in Options, measure only
+using EventBus = BasicEventBus<Event, SpscRingBuffer<Event>, RuntimeWait, SteadyClock, NoopHandler>;
+
+// Instantiated once in event_bus.cpp
+extern template class BasicEventBus<Event, SpscRingBuffer<Event>, RuntimeWait, SteadyClock, NoopHandler>;
+
+
+// --- Implementation -----------------------------------------------------------------------
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+auto BasicEventBus<Payload, Queue, Wait, Clock, Handler>::sized_options_(std::size_t ring_capacity,
+                                                                         std::size_t max_latency_samples) -> Options {
+    Options opts{};
+    opts.ring_capacity = ring_capacity;
+    opts.max_latency_samples = max_latency_samples;
+    return opts;
+}
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+BasicEventBus<Payload, Queue, Wait, Clock, Handler>::BasicEventBus(std::size_t ring_capacity, std::size_t max_latency_samples)
+    : BasicEventBus(sized_options_(ring_capacity, max_latency_samples)) {}
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+BasicEventBus<Payload, Queue, Wait, Clock, Handler>::BasicEventBus(const Options& opts, Handler handler)
+    : opts_(opts),
+      wait_(detail::make_wait<Wait>(opts.wait)),
+      handler_(std::move(handler)),
+      rb_(opts.ring_capacity),
+      latency_(opts.max_latency_samples),
+      md_(opts, Clock::now_ns())
+#if SPSC_TRACING
+      , tracing_(opts.trace_sample_every != 0),
+      trace_mask_(round_up_pow2(opts.trace_sample_every) - 1),
+      hop_produce_(opts.trace_capacity),
+      producer_trace_(opts.trace_capacity),
+      hop_handle_(opts.trace_capacity),
+      consumer_trace_(opts.trace_capacity)
+#endif
+{
+    if (opts.round_trip && !ingests_()) {
+        // Never more than in_flight replies outstanding, so the echo never finds the ring full
+        replies_ = std::make_unique<Queue>(std::clamp<std::size_t>(opts.in_flight, 1, rb_.capacity()));
+        rtt_half_ = std::make_unique<LatencyTracker>(opts.max_latency_samples);
+    }
+
+#if SPSC_TRACING
+    // round_up_pow2 maps 1 to 2; sampling every event is a valid request
+    if (opts.trace_sample_every == 1) trace_mask_ = 0;
+#endif
+}
+
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+BasicEventBus<Payload, Queue, Wait, Clock, Handler>::~BasicEventBus() {
+    stop_and_join();
+    workers_.shutdown();            // before the members the threads use go away
+}
+
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+void BasicEventBus<Payload, Queue, Wait, Clock, Handler>::launch() {
+    workers_.launch(opts_.producer_core, opts_.consumer_core, opts_.memory,
+                    [this](Role role) { prefault_(role); },
+                    [this](Role role) { run_(role); });
+}
+
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+void BasicEventBus<Payload, Queue, Wait, Clock, Handler>::start(std::uint64_t target_events) {
+    // If already running, do nothing
+    if (running_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    launch();
+
+    // Reset state
+    stop_.store(false, std::memory_order_release);
+    replies_drained_.store(false, std::memory_order_release);
+    running_.store(true, std::memory_order_release);
+
+    produced_ = 0;
+    consumed_ = 0;
+    push_fail_spins_ = 0;
+    pop_fail_spins_ = 0;
+    seq_mismatch_ = 0;
+    round_trips_ = 0;
+    expected_seq_ = 0;
+
+    latency_.reset();
+    if (rtt_half_) rtt_half_->reset();
+
+    if constexpr (kEventPayload) {
+        md_.outliers.reset();
+#if SPSC_UDP_INGEST
+        md_.packets = 0;
+        md_.bad_packets = 0;
+        md_.packet_gaps = 0;
+        md_.rx_empty_polls = 0;
+#endif
+    }
+
+#if SPSC_TRACING
+    hop_produce_.reset();
+    hop_handle_.reset();
+    producer_trace_.clear();
+    consumer_trace_.clear();
+#endif
+
+    // Wake the parked threads
+    target_events_ = target_events;
+    workers_.start();
+}
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+void BasicEventBus<Payload, Queue, Wait, Clock, Handler>::stop() noexcept {
+    stop_.store(true, std::memory_order_release);
+}
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+void BasicEventBus<Payload, Queue, Wait, Clock, Handler>::join() {
+    if (!running_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    workers_.join();
+    running_.store(false, std::memory_order_release);
+}
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+void BasicEventBus<Payload, Queue, Wait, Clock, Handler>::stop_and_join() noexcept {
+    stop();
+    join();
+}
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+LatencyTracker::Stats BasicEventBus<Payload, Queue, Wait, Clock, Handler>::latency_stats() const {
+    return latency_.compute();
+}
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+LatencyTracker::Stats BasicEventBus<Payload, Queue, Wait, Clock, Handler>::rtt_half_stats() const {
+    return rtt_half_ ? rtt_half_->compute() : LatencyTracker::Stats{};
+}
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+EventBusHopStats BasicEventBus<Payload, Queue, Wait, Clock, Handler>::hop_stats() const {
+    HopStats h{};
+    h.ring = latency_.compute();
+#if SPSC_TRACING
+    h.produce = hop_produce_.compute();
+    h.handle = hop_handle_.compute();
+#endif
+    return h;
+}
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+void BasicEventBus<Payload, Queue, Wait, Clock, Handler>::write_trace(ChromeTraceWriter& writer, std::uint32_t pid, const char* name) const {
+#if SPSC_TRACING
+    writer.add_process(pid, name);
+    writer.add(producer_trace_, pid);
+    writer.add(consumer_trace_, pid);
+#else
+    (void)writer;
+    (void)pid;
+    (void)name;
+#endif
+}
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+auto BasicEventBus<Payload, Queue, Wait, Clock, Handler>::counters() const noexcept -> Counters {
+    Counters c{};
+    c.produced = produced_;
+    c.consumed = consumed_;
+    c.push_fail_spins = push_fail_spins_;
+    c.pop_fail_spins = pop_fail_spins_;
+    c.seq_mismatch = seq_mismatch_;
+    c.round_trips = round_trips_;
+
+    if constexpr (kEventPayload) {
+        if (md_.feed) {
+            c.heartbeats = md_.feed->heartbeats();
+            c.stale_events = md_.feed->stale_events();
+        }
+#if SPSC_UDP_INGEST
+        c.packets = md_.packets;
+        c.bad_packets = md_.bad_packets;
+        c.packet_gaps = md_.packet_gaps;
+        c.rx_empty_polls = md_.rx_empty_polls;
+#endif
+    }
+    return c;
+}
+
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+void BasicEventBus<Payload, Queue, Wait, Clock, Handler>::prefault_(Role role) {
+    // Each thread touches the memory it writes (MemoryPolicy::Prefault, after pinning)
+    if (role == Role::Producer) {
+        rb_.prefault();
+        if (rtt_half_) rtt_half_->prefault();
+#if SPSC_UDP_INGEST
+        if constexpr (kEventPayload) {
+            if (md_.udp) md_.udp->prefault();
+        }
+#endif
+    }
+    else {
+        latency_.prefault();
+        if (replies_) replies_->prefault();
+    }
+}
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+void BasicEventBus<Payload, Queue, Wait, Clock, Handler>::run_(Role role) {
+    if (role == Role::Consumer) consumer_loop_();
+#if SPSC_UDP_INGEST
+    else if (ingests_()) ingest_loop_(target_events_);
+#endif
+    else if (replies_) round_trip_loop_(target_events_);
+    else producer_loop_(target_events_);
+}
+
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+void BasicEventBus<Payload, Queue, Wait, Clock, Handler>::producer_loop_(std::uint64_t target_events) {
+    std::uint64_t seq = 0;
+
+#if SPSC_TRACING
+    // Produce hop starts at the first push attempt for a seq, not the retry that succeeds
+    std::uint64_t produce_ns = 0;
+    std::uint64_t produce_seq = ~std::uint64_t{0};
+#endif
+
+    while (!stop_.load(std::memory_order_acquire)) {
+        if (target_events != 0 && seq >= target_events) {
+            // Produced the requested number of events; request stop
+            stop_.store(true, std::memory_order_release);
+            break;
+        }
+
+        Payload e{};
+        e.enqueue_ns = Clock::now_ns();
+        e.seq = seq;
+        if constexpr (kEventPayload) detail::fill_payload(e, seq);
+
+#if SPSC_TRACING
+        const bool traced = tracing_ && (seq & trace_mask_) == 0;
+        if (traced && seq != produce_seq) {
+            produce_seq = seq;
+            produce_ns = e.enqueue_ns;
+        }
+#endif
+
+        if (rb_.try_push(std::move(e))) {
+#if SPSC_TRACING
+            if (traced) {
+                const std::uint64_t pushed = Clock::now_ns();
+                hop_produce_.record_ns(pushed - produce_ns);
+                producer_trace_.record(Hop::Produce, seq, produce_ns, pushed);
+            }
+#endif
+            ++seq;
+            ++produced_;
+        }
+        else {
+            ++push_fail_spins_;
+            wait_.idle(push_fail_spins_);
+        }
+    }
+}
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+void BasicEventBus<Payload, Queue, Wait, Clock, Handler>::round_trip_loop_(std::uint64_t target_events) {
+    const std::size_t window = std::clamp<std::size_t>(opts_.in_flight, 1, rb_.capacity());
+
+    std::uint64_t seq = 0;
+    std::uint64_t outstanding = 0;
+    std::uint64_t next_send_ns = 0;
+    std::uint64_t idle_spins = 0;           // waiting on replies / think time is not a push failure
+    bool sending = true;
+
+    for (;;) {
+        bool progress = false;
+
+        Payload r{};
+        while (replies_->try_pop(r)) {
+            const std::uint64_t now = Clock::now_ns();
+            rtt_half_->record_ns((now - r.enqueue_ns) / 2);
+            ++round_trips_;
+            --outstanding;
+            next_send_ns = now + opts_.think_ns;
+            progress = true;
+        }
+
+        if (sending && (stop_.load(std::memory_order_acquire) || (target_events != 0 && seq >= target_events))) {
+            sending = false;
+        }
+
+        if (!sending) {
+            // Every sent event is echoed; wait for the last reply before releasing the consumer
+            if (outstanding == 0) break;
+        }
+        else if (outstanding < window) {
+            const std::uint64_t now = Clock::now_ns();
+            if (now >= next_send_ns) {
+                Payload e{};
+                e.enqueue_ns = now;
+                e.seq = seq;
+                if constexpr (kEventPayload) detail::fill_payload(e, seq);
+
+                if (rb_.try_push(std::move(e))) {
+                    ++seq;
+                    ++produced_;
+                    ++outstanding;
+                    progress = true;
+                }
+                else {
+                    ++push_fail_spins_;
+                }
+            }
+        }
+
+        if (!progress) {
+            wait_.idle(++idle_spins);
+        }
+    }
+
+    stop_.store(true, std::memory_order_release);
+    replies_drained_.store(true, std::memory_order_release);
+}
+
+#if SPSC_UDP_INGEST
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+void BasicEventBus<Payload, Queue, Wait, Clock, Handler>::ingest_loop_(std::uint64_t target_events) {
+    if constexpr (kEventPayload) {
+        // A packet is never split: the run may end up to one packet past target_events
+        while (!stop_.load(std::memory_order_acquire)) {
+            if (target_events != 0 && produced_ >= target_events) {
+                stop_.store(true, std::memory_order_release);
+                break;
+            }
+
+            const std::size_t n = md_.udp->receive();
+            if (n == 0) {
+                ++md_.rx_empty_polls;
+                wait_.idle(md_.rx_empty_polls);
+                continue;
+            }
+
+            for (std::size_t i = 0; i < n; ++i) {
+                const UdpIngest::Packet p = md_.udp->packet(i);
+
+                // Decoded straight into ring slots; the socket buffer absorbs bursts while the ring is full
+                wire::PacketHeader h;
+                const bool ok = wire::decode_packet(p.data, p.len, p.rx_ns, h, [this](const Event& e) {
+                    while (!rb_.try_push(Event{e})) {
+                        ++push_fail_spins_;
+                        wait_.idle(push_fail_spins_);
+                    }
+                    ++produced_;
+                });
+
+                if (!ok) {
+                    ++md_.bad_packets;
+                    continue;
+                }
+
+                // Forward jumps are losses; a backwards jump means the sender restarted
+                if (md_.seen_packet && h.packet_seq > md_.next_packet_seq) {
+                    md_.packet_gaps += h.packet_seq - md_.next_packet_seq;
+                }
+                md_.next_packet_seq = h.packet_seq + 1;
+                md_.seen_packet = true;
+                ++md_.packets;
+            }
+        }
+    }
+    else {
+        (void)target_events;
+    }
+}
+#endif
+
+template <BusPayload Payload, BusQueue<Payload> Queue, WaitPolicy Wait, BusClock Clock, BusHandler<Payload> Handler>
+void BasicEventBus<Payload, Queue, Wait, Clock, Handler>::consumer_loop_() {
+    expected_seq_ = 0;
+
+    // Round-trip: the producer decides when the run is over (stop_ alone could strand an in-flight event)
+    const std::atomic<bool>& done = replies_ ? replies_drained_ : stop_;
+
+    if constexpr (kEventPayload) {
+        if (md_.timers) {
+            md_.timers->reset(Clock::now_ns());
+            md_.feed->reset();
+            md_.feed->start();
+        }
+    }
+
+    while (!done.load(std::memory_order_acquire) || !rb_.empty()) {
+        if constexpr (kEventPayload) md_.outliers.service_snapshot();
+
+        Payload e{};
+        if (rb_.try_pop(e)) {
+            const std::uint64_t now = Clock::now_ns();
+            const std::uint64_t lat = now - e.enqueue_ns;
+
+            latency_.record_ns(lat);
+
+            if (replies_) {
+                // Window <= reply capacity: only spins if the producer is slow to drain
+                while (!replies_->try_push(Payload{e})) cpu_relax();
+            }
+
+            if constexpr (kEventPayload) {
+                // Ring depth is only read for outliers
+                if (md_.outliers.wants(lat)) {
+                    md_.outliers.record(e, now, rb_.size());
+                }
+
+                // Timers run off the dequeue timestamp we already have
+                if (md_.timers) {
+                    md_.feed->on_event(e.instrument_id, now);
+                    md_.timers->advance(now);
+                }
+            }
+            ++consumed_;
+
+            // Check FIFO end-to-end
+            if (e.seq != expected_seq_) {
+                ++seq_mismatch_;
+                expected_seq_ = e.seq + 1; //resync
+            }
+            else {
+                ++expected_seq_;
+            }
+
+            handler_(static_cast<const Payload&>(e), now);
+
+#if SPSC_TRACING
+            if (tracing_ && (e.seq & trace_mask_) == 0) {
+                const std::uint64_t done_ns = Clock::now_ns();
+                hop_handle_.record_ns(done_ns - now);
+                consumer_trace_.record(Hop::Ring, e.seq, e.enqueue_ns, now);
+                consumer_trace_.record(Hop::Handle, e.seq, now, done_ns);
+            }
+#endif
+        }
+        else {
+            ++pop_fail_spins_;
+
+            // A quiet feed still needs its timers: read the clock every 1024 empty polls
+            if constexpr (kEventPayload) {
+                if (md_.timers && (pop_fail_spins_ & 0x3FFu) == 0) {
+                    md_.timers->advance(Clock::now_ns());
+                }
+            }
+
+            wait_.idle(pop_fail_spins_);
+        }
+    }
+}
+
+}//namespace spsc
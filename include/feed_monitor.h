@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "timer_wheel.h"
+
+namespace spsc {
+
+// Callbacks run on the thread that advances the wheel (the consumer); keep them short
+struct FeedHooks {
+    void (*on_heartbeat)(void* ctx, std::uint64_t now_ns){nullptr};
+    void (*on_stale)(void* ctx, std::uint32_t instrument_id, std::uint64_t last_seen_ns, std::uint64_t now_ns){nullptr};
+    void* ctx{nullptr};
+};
+
+// Heartbeat emission and stale-instrument detection on top of a TimerWheel.
+// Per-event cost is a store and a branch: the stale timer for an instrument is armed once and,
+// when it fires, re-armed at last_seen + stale_after if the instrument has ticked since.
+class FeedMonitor final {
+public:
+    using Hooks = FeedHooks;
+
+    // stale_after_ns = 0 disables stale detection; heartbeat_every_ns = 0 disables heartbeats
+    FeedMonitor(TimerWheel& wheel, std::size_t max_instruments,
+                std::uint64_t stale_after_ns, std::uint64_t heartbeat_every_ns, Hooks hooks = {});
+
+    FeedMonitor(const FeedMonitor&) = delete;
+    FeedMonitor& operator=(const FeedMonitor&) = delete;
+
+    // Arm the heartbeat timer (timers are relative to the wheel's current time)
+    void start() noexcept;
+
+    // Forget all instruments and counters; call after TimerWheel::reset (which drops our timers)
+    void reset() noexcept;
+
+    // Hot path: instrument ticked at now_ns (ids >= max_instruments are ignored)
+    void on_event(std::uint32_t instrument_id, std::uint64_t now_ns) noexcept {
+        if (stale_after_ns_ == 0 || instrument_id >= max_instruments_) return;
+
+        last_seen_[instrument_id] = now_ns;
+        if (!armed_[instrument_id]) {
+            arm_(instrument_id, now_ns + stale_after_ns_);
+        }
+    }
+
+    std::uint64_t heartbeats() const noexcept { return heartbeats_; }
+    std::uint64_t stale_events() const noexcept { return stale_events_; }
+    std::uint64_t timer_pool_exhausted() const noexcept { return pool_exhausted_; }
+
+private:
+    static void heartbeat_cb_(void* ctx, std::uint64_t arg, std::uint64_t now_ns);
+    static void stale_cb_(void* ctx, std::uint64_t arg, std::uint64_t now_ns);
+
+    void arm_(std::uint32_t instrument_id, std::uint64_t deadline_ns) noexcept;
+    void arm_heartbeat_() noexcept;
+
+    TimerWheel& wheel_;
+    const std::size_t max_instruments_;
+    const std::uint64_t stale_after_ns_;
+    const std::uint64_t heartbeat_every_ns_;
+    const Hooks hooks_;
+
+    std::unique_ptr<std::uint64_t[]> last_seen_;
+    std::unique_ptr<bool[]> armed_;
+
+    std::uint64_t next_heartbeat_ns_{0};
+    std::uint64_t heartbeats_{0};
+    std::uint64_t stale_events_{0};
+    std::uint64_t pool_exhausted_{0};
+};
+
+}//namespace spsc
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "event.h"
+
+namespace spsc::wire {
+
+// Binary feed packet (little-endian, no alignment assumed on receive):
+//
+//   PacketHeader   24 bytes   magic, version, event count, packet sequence, sender timestamp
+//   EventRecord    32 bytes   x count
+//
+// One packet fits a 1500-byte MTU UDP datagram with up to kMaxEventsPerPacket events.
+inline constexpr std::uint16_t kMagic = 0x4245;         // "EB"
+inline constexpr std::uint8_t kVersion = 1;
+
+struct PacketHeader {
+    std::uint16_t magic{kMagic};
+    std::uint8_t version{kVersion};
+    std::uint8_t count{0};
+    std::uint32_t _pad{0};
+    std::uint64_t packet_seq{0};        // consecutive per sender; gaps = lost packets
+    std::uint64_t send_ns{0};           // sender clock, informational only
+};
+
+struct EventRecord {
+    std::uint64_t seq{0};
+    std::int64_t price_ticks{0};
+    std::uint32_t instrument_id{0};
+    std::uint32_t qty{0};
+    std::uint8_t type{0};
+    std::uint8_t side{0};
+    std::uint8_t _pad[6]{};
+};
+
+static_assert(sizeof(PacketHeader) == 24);
+static_assert(sizeof(EventRecord) == 32);
+
+// Host <-> wire (little-endian) byte order; the same swap in both directions, free on LE hosts
+template <std::unsigned_integral T>
+constexpr T wire_order(T v) noexcept {
+    if constexpr (std::endian::native == std::endian::little || sizeof(T) == 1) {
+        return v;
+    }
+    else {
+        T out{0};
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            out = static_cast<T>((out << 8) | (v & 0xFF));
+            v = static_cast<T>(v >> 8);
+        }
+        return out;
+    }
+}
+
+constexpr std::int64_t wire_order(std::int64_t v) noexcept {
+    return static_cast<std::int64_t>(wire_order(static_cast<std::uint64_t>(v)));
+}
+
+inline constexpr std::size_t kMaxDatagram = 1472;       // 1500 MTU - IPv4 - UDP headers
+inline constexpr std::size_t kMaxEventsPerPacket = (kMaxDatagram - sizeof(PacketHeader)) / sizeof(EventRecord);
+
+// Serialise up to kMaxEventsPerPacket events; returns the datagram size (0 if out is too small)
+inline std::size_t encode_packet(std::byte* out, std::size_t out_len, std::uint64_t packet_seq,
+                                 std::uint64_t send_ns, const Event* events, std::size_t count) noexcept {
+    if (count > kMaxEventsPerPacket) count = kMaxEventsPerPacket;
+
+    const std::size_t len = sizeof(PacketHeader) + count * sizeof(EventRecord);
+    if (out_len < len) return 0;
+
+    PacketHeader h{};
+    h.magic = wire_order(kMagic);
+    h.count = static_cast<std::uint8_t>(count);
+    h.packet_seq = wire_order(packet_seq);
+    h.send_ns = wire_order(send_ns);
+    std::memcpy(out, &h, sizeof(h));
+
+    std::byte* p = out + sizeof(h);
+    for (std::size_t i = 0; i < count; ++i, p += sizeof(EventRecord)) {
+        EventRecord r{};
+        r.seq = wire_order(events[i].seq);
+        r.price_ticks = wire_order(events[i].price_ticks);
+        r.instrument_id = wire_order(events[i].instrument_id);
+        r.qty = wire_order(events[i].qty);
+        r.type = static_cast<std::uint8_t>(events[i].type);
+        r.side = static_cast<std::uint8_t>(events[i].side);
+        std::memcpy(p, &r, sizeof(r));
+    }
+    return len;
+}
+
+// Enum fields arrive as raw bytes: anything past the last enumerator would index out of
+// EventType / Side tables downstream
+inline bool valid_record(const EventRecord& r) noexcept {
+    return r.type <= static_cast<std::uint8_t>(EventType::Heartbeat)
+        && r.side <= static_cast<std::uint8_t>(Side::Sell);
+}
+
+// Validate the header and hand each event to sink(const Event&) with enqueue_ns = rx_ns.
+// Returns false (and calls sink for nothing) on a short, truncated or foreign datagram, or one
+// carrying an out-of-range type / side.
+template <typename Sink>
+inline bool decode_packet(const std::byte* data, std::size_t len, std::uint64_t rx_ns,
+                          PacketHeader& header, Sink&& sink) {
+    if (len < sizeof(PacketHeader)) return false;
+    std::memcpy(&header, data, sizeof(header));
+    header.magic = wire_order(header.magic);
+    header.packet_seq = wire_order(header.packet_seq);
+    header.send_ns = wire_order(header.send_ns);
+
+    if (header.magic != kMagic || header.version != kVersion) return false;
+    if (len < sizeof(PacketHeader) + header.count * sizeof(EventRecord)) return false;
+
+    // All-or-nothing: check every record before the first reaches the sink
+    const std::byte* const records = data + sizeof(PacketHeader);
+    for (std::uint8_t i = 0; i < header.count; ++i) {
+        EventRecord r;
+        std::memcpy(&r, records + i * sizeof(EventRecord), sizeof(r));
+        if (!valid_record(r)) return false;
+    }
+
+    const std::byte* p = records;
+    for (std::uint8_t i = 0; i < header.count; ++i, p += sizeof(EventRecord)) {
+        EventRecord r;
+        std::memcpy(&r, p, sizeof(r));
+
+        Event e{};
+        e.enqueue_ns = rx_ns;
+        e.seq = wire_order(r.seq);
+        e.price_ticks = wire_order(r.price_ticks);
+        e.instrument_id = wire_order(r.instrument_id);
+        e.qty = wire_order(r.qty);
+        e.type = static_cast<EventType>(r.type);
+        e.side = static_cast<Side>(r.side);
+        sink(e);
+    }
+    return true;
+}
+
+}//namespace spsc::wire
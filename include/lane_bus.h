@@ -0,0 +1,340 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "bus_policies.h"
+#include "bus_workers.h"
+#include "event.h"
+#include "latency_tracker.h"
+#include "poll_set.h"
+
+namespace spsc {
+
+inline constexpr std::size_t kEventTypes = 3;
+
+// Synthetic mixed feed for the lane bus producer. Event types are a pure function of seq, so
+// handlers and benchmarks can tell which phase an event belongs to.
+struct LaneWorkload {
+    std::uint32_t quotes_per_trade{4};          // steady mix: quotes between consecutive trades
+    std::uint64_t heartbeat_every{4096};        // every Nth event is a heartbeat (0 = none)
+    std::uint64_t gap_ns{0};                    // producer pacing between events outside bursts
+
+    // Quote storm: the first burst_len events of every burst_every are unpaced and quote-heavy
+    std::uint64_t burst_every{0};               // 0 = no bursts
+    std::uint64_t burst_len{0};
+    std::uint32_t burst_quotes_per_trade{256};
+
+    bool in_burst(std::uint64_t seq) const noexcept {
+        return burst_every != 0 && (seq % burst_every) < burst_len;
+    }
+
+    EventType type_at(std::uint64_t seq) const noexcept {
+        if (heartbeat_every != 0 && seq % heartbeat_every == heartbeat_every - 1) return EventType::Heartbeat;
+        const std::uint64_t period = std::uint64_t{in_burst(seq) ? burst_quotes_per_trade : quotes_per_trade} + 1;
+        return (seq % period == 0) ? EventType::Trade : EventType::Quote;
+    }
+};
+
+struct LaneBusOptions {
+    std::size_t lane_capacity{1 << 14};
+    std::size_t max_latency_samples{1 << 20};       // per lane
+
+    int producer_core{-1};          // -1 = no pinning
+    int consumer_core{-1};
+
+    WaitStrategy wait{WaitStrategy::SpinYield};     // used by RuntimeWait only
+    MemoryPolicy memory{MemoryPolicy::Lazy};
+
+    // Lane per EventType (indexed by the enum value); lane 0 is drained first. Lanes = max + 1.
+    // All zeros gives a single FIFO ring, i.e. plain EventBus ordering.
+    std::array<std::uint8_t, kEventTypes> lane_of{0, 1, 0};     // Trade, Quote, Heartbeat
+
+    // Consumer: each poll hands out at most `batch` events, highest lane first, so a new
+    // high-priority event waits for at most one batch of lower-priority work.
+    // A ready lane skipped for starvation_limit consecutive polls is served first (0 = never).
+    std::size_t batch{32};
+    std::uint64_t starvation_limit{64};
+
+    LaneWorkload workload{};
+};
+
+
+// Multi-lane bus: one producer classifies events by EventType into per-lane SPSC rings; one
+// consumer drains them through a priority PollSet with bounded starvation. Latency is tracked
+// per lane. Same thread lifecycle as BasicEventBus: pinned, prefaulted threads park between runs.
+template <BusHandler<Event> Handler = NoopHandler, WaitPolicy Wait = RuntimeWait>
+class PriorityLaneBus final {
+public:
+    using Options = LaneBusOptions;
+    using Counters = WorkerCounters;                // seq_mismatch counts per-lane FIFO violations
+
+    struct LaneStats {
+        LatencyTracker::Stats latency{};
+        std::uint64_t consumed{0};
+        std::uint64_t starved_polls{0};             // polls where the lane was ready but got nothing
+        std::uint64_t max_starved_streak{0};        // bounded by starvation_limit when it is set
+    };
+
+    explicit PriorityLaneBus(const Options& opts, Handler handler = Handler{});
+
+    PriorityLaneBus(const PriorityLaneBus&) = delete;
+    PriorityLaneBus& operator=(const PriorityLaneBus&) = delete;
+
+    ~PriorityLaneBus();
+
+    // Spawn the producer/consumer threads (pinned, prefaulted per Options) and park them.
+    // Called by start() if needed; threads stay alive across start/join cycles until destruction.
+    void launch();
+
+    // Produce target_events (0 = until stop()) from the workload; stats reset per run
+    void start(std::uint64_t target_events = 0);
+    void stop() noexcept { stop_.store(true, std::memory_order_release); }
+    void join();
+    void stop_and_join() noexcept { stop(); join(); }
+
+    std::size_t lanes() const noexcept { return set_.size(); }
+    std::size_t lane_of(EventType t) const noexcept { return opts_.lane_of[static_cast<std::size_t>(t)]; }
+
+    // Offline (after join)
+    LaneStats lane_stats(std::size_t lane) const;
+    Counters counters() const noexcept;
+
+    // The consumer's handler; only touch it while no run is in progress
+    Handler& handler() noexcept { return handler_; }
+
+    bool running() const noexcept { return running_.load(std::memory_order_acquire); }
+    const Options& options() const noexcept { return opts_; }
+
+private:
+    using Role = BusWorkers::Role;
+
+    static std::size_t lane_count_(const Options& opts);
+
+    void prefault_(Role role);
+    void run_(Role role);
+    void producer_loop_(std::uint64_t target_events);
+    void consumer_loop_();
+
+    const Options opts_;
+    [[no_unique_address]] Wait wait_;
+    [[no_unique_address]] Handler handler_;             // consumer thread only
+
+    PollSet<Event> set_;
+    std::vector<std::unique_ptr<LatencyTracker>> latency_;     // consumer thread only
+    std::vector<std::uint64_t> next_seq_;                       // consumer thread only
+
+    BusWorkers workers_;
+
+    std::atomic<bool> stop_{false};
+    std::atomic<bool> running_{false};
+    std::uint64_t target_events_{0};                    // published by workers_.start()
+
+    // Counters (written by threads, read after join)
+    alignas(64) std::uint64_t produced_{0};             // producer thread only
+    std::uint64_t push_fail_spins_{0};
+
+    alignas(64) std::uint64_t consumed_{0};             // consumer thread only
+    std::uint64_t pop_fail_spins_{0};
+    std::uint64_t seq_mismatch_{0};
+};
+
+
+template <BusHandler<Event> Handler, WaitPolicy Wait>
+std::size_t PriorityLaneBus<Handler, Wait>::lane_count_(const Options& opts) {
+    std::size_t n = 0;
+    for (const auto lane : opts.lane_of) {
+        if (lane + 1u > n) n = lane + 1u;
+    }
+    return n;
+}
+
+template <BusHandler<Event> Handler, WaitPolicy Wait>
+PriorityLaneBus<Handler, Wait>::PriorityLaneBus(const Options& opts, Handler handler)
+    : opts_(opts),
+      wait_(detail::make_wait<Wait>(opts.wait)),
+      handler_(std::move(handler)),
+      set_(lane_count_(opts), opts.lane_capacity,
+           PollSet<Event>::Options{PollPolicy::Priority, opts.batch, opts.starvation_limit}),
+      next_seq_(set_.size(), 0) {
+
+    if (opts.max_latency_samples == 0) {
+        throw std::invalid_argument("PriorityLaneBus: max_latency_samples must be > 0");
+    }
+    latency_.reserve(set_.size());
+    for (std::size_t i = 0; i < set_.size(); ++i) {
+        latency_.push_back(std::make_unique<LatencyTracker>(opts.max_latency_samples));
+    }
+}
+
+template <BusHandler<Event> Handler, WaitPolicy Wait>
+PriorityLaneBus<Handler, Wait>::~PriorityLaneBus() {
+    stop_and_join();
+    workers_.shutdown();            // before the members the threads use go away
+}
+
+template <BusHandler<Event> Handler, WaitPolicy Wait>
+void PriorityLaneBus<Handler, Wait>::launch() {
+    workers_.launch(opts_.producer_core, opts_.consumer_core, opts_.memory,
+                    [this](Role role) { prefault_(role); },
+                    [this](Role role) { run_(role); });
+}
+
+template <BusHandler<Event> Handler, WaitPolicy Wait>
+void PriorityLaneBus<Handler, Wait>::start(std::uint64_t target_events) {
+    if (running_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    launch();
+
+    stop_.store(false, std::memory_order_release);
+    running_.store(true, std::memory_order_release);
+
+    produced_ = 0;
+    push_fail_spins_ = 0;
+    consumed_ = 0;
+    pop_fail_spins_ = 0;
+    seq_mismatch_ = 0;
+
+    for (auto& t : latency_) t->reset();
+    for (auto& s : next_seq_) s = 0;
+    set_.reset_stats();
+
+    // Wake the parked threads
+    target_events_ = target_events;
+    workers_.start();
+}
+
+template <BusHandler<Event> Handler, WaitPolicy Wait>
+void PriorityLaneBus<Handler, Wait>::join() {
+    if (!running_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    workers_.join();
+    running_.store(false, std::memory_order_release);
+}
+
+template <BusHandler<Event> Handler, WaitPolicy Wait>
+typename PriorityLaneBus<Handler, Wait>::LaneStats PriorityLaneBus<Handler, Wait>::lane_stats(std::size_t lane) const {
+    const auto& s = set_.stats(lane);
+
+    LaneStats out{};
+    out.latency = latency_[lane]->compute();
+    out.consumed = s.consumed;
+    out.starved_polls = s.starved_polls;
+    out.max_starved_streak = s.max_starved_streak;
+    return out;
+}
+
+template <BusHandler<Event> Handler, WaitPolicy Wait>
+typename PriorityLaneBus<Handler, Wait>::Counters PriorityLaneBus<Handler, Wait>::counters() const noexcept {
+    Counters c{};
+    c.produced = produced_;
+    c.consumed = consumed_;
+    c.push_fail_spins = push_fail_spins_;
+    c.pop_fail_spins = pop_fail_spins_;
+    c.seq_mismatch = seq_mismatch_;
+    return c;
+}
+
+template <BusHandler<Event> Handler, WaitPolicy Wait>
+void PriorityLaneBus<Handler, Wait>::prefault_(Role role) {
+    // Each thread touches the memory it writes (MemoryPolicy::Prefault, after pinning)
+    if (role == Role::Producer) {
+        for (std::size_t i = 0; i < set_.size(); ++i) set_.ring(i).prefault();
+    }
+    else {
+        for (auto& t : latency_) t->prefault();
+    }
+}
+
+template <BusHandler<Event> Handler, WaitPolicy Wait>
+void PriorityLaneBus<Handler, Wait>::run_(Role role) {
+    if (role == Role::Consumer) consumer_loop_();
+    else producer_loop_(target_events_);
+}
+
+template <BusHandler<Event> Handler, WaitPolicy Wait>
+void PriorityLaneBus<Handler, Wait>::producer_loop_(std::uint64_t target_events) {
+    const LaneWorkload& w = opts_.workload;
+
+    std::uint64_t seq = 0;
+    std::uint64_t next_ns = 0;
+
+    while (!stop_.load(std::memory_order_acquire)) {
+        if (target_events != 0 && seq >= target_events) {
+            stop_.store(true, std::memory_order_release);
+            break;
+        }
+
+        // Steady phase is paced; bursts go as fast as the lanes accept
+        const bool burst = w.in_burst(seq);
+        if (w.gap_ns != 0 && !burst) {
+            if (SteadyClock::now_ns() < next_ns) {
+                cpu_relax();
+                continue;
+            }
+        }
+
+        const std::uint64_t stamp = SteadyClock::now_ns();
+        const EventType type = w.type_at(seq);
+
+        Event e{};
+        e.enqueue_ns = stamp;
+        e.seq = seq;
+        detail::fill_payload(e, seq);
+        e.type = type;
+
+        if (set_.try_push(lane_of(type), std::move(e))) {
+            next_ns = stamp + w.gap_ns;
+            ++seq;
+            ++produced_;
+        }
+        else {
+            ++push_fail_spins_;
+            wait_.idle(push_fail_spins_);
+        }
+    }
+}
+
+template <BusHandler<Event> Handler, WaitPolicy Wait>
+void PriorityLaneBus<Handler, Wait>::consumer_loop_() {
+    auto drained = [this] {
+        for (std::size_t i = 0; i < set_.size(); ++i) {
+            if (!set_.ring(i).empty()) return false;
+        }
+        return true;
+    };
+
+    auto on_event = [this](std::size_t lane, Event& e) {
+        const std::uint64_t now = SteadyClock::now_ns();
+        latency_[lane]->record_ns(now - e.enqueue_ns);
+
+        // Lanes reorder across types, never within a lane
+        if (e.seq < next_seq_[lane]) ++seq_mismatch_;
+        next_seq_[lane] = e.seq + 1;
+
+        handler_(static_cast<const Event&>(e), now);
+        ++consumed_;
+    };
+
+    // Producer pushes happen-before its stop store, so stop + all lanes empty means done
+    while (!stop_.load(std::memory_order_acquire) || !drained()) {
+        if (set_.poll(on_event, opts_.batch) == 0) {
+            ++pop_fail_spins_;
+            wait_.idle(pop_fail_spins_);
+        }
+    }
+}
+
+using LaneBus = PriorityLaneBus<>;
+
+}//namespace spsc
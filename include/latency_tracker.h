@@ -35,6 +35,9 @@ public:
     // Reset counters/samples (does not free/reallocate storage)
     void reset() noexcept; 
 
+    // Touch every page of sample storage from the calling thread (see SpscRingBuffer::prefault)
+    void prefault() noexcept; 
+
     std::size_t capacity() const noexcept { return capacity_; }
     std::size_t count() const noexcept { return count_; }
 
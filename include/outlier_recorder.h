@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <vector>
+
+#include "event.h"
+
+namespace spsc {
+
+struct OutlierRecord {
+    std::uint64_t latency_ns{0};
+    std::uint64_t seq{0};
+    std::uint64_t enqueue_ns{0};
+    std::uint64_t dequeue_ns{0};
+    std::uint32_t instrument_id{0};
+    std::uint32_t ring_depth{0};        // events still queued behind this one at dequeue
+    EventType type{EventType::Trade};
+};
+
+// Keeps the context of the slowest events seen by a consumer:
+//  - top-K: the K highest latencies of the run (min-heap, one compare to reject on the hot path)
+//  - threshold: the most recent events at or above threshold_ns (ring semantics), for
+//    correlating spikes with bursts or pauses in time order
+// All storage is allocated up front; record() never allocates and is single-writer (consumer thread).
+class OutlierRecorder final {
+public:
+    // top_k = 0 disables top-K; threshold_ns = 0 disables threshold capture
+    OutlierRecorder(std::size_t top_k, std::uint64_t threshold_ns, std::size_t threshold_capacity);
+
+    OutlierRecorder(const OutlierRecorder&) = delete;
+    OutlierRecorder& operator=(const OutlierRecorder&) = delete;
+
+    // Hot path: cheap pre-check so the caller only gathers context (ring depth) for outliers
+    bool wants(std::uint64_t latency_ns) const noexcept {
+        return (top_k_ != 0 && latency_ns > floor_ns_) || (threshold_ns_ != 0 && latency_ns >= threshold_ns_);
+    }
+
+    void record(const Event& e, std::uint64_t dequeue_ns, std::size_t ring_depth) noexcept;
+
+    // Any thread: ask the consumer to publish a copy at its next service_snapshot() call
+    void request_snapshot() noexcept;
+
+    // Consumer thread: publish a snapshot if one was requested (one relaxed load otherwise)
+    void service_snapshot() noexcept {
+        if (snap_state_.load(std::memory_order_relaxed) == kSnapRequested) {
+            publish_snapshot_();
+        }
+    }
+
+    // Any thread: if a requested snapshot is ready, copy it out (slowest first) and return true.
+    // Concurrent callers are fine: one claims the snapshot, the others get false, and no new
+    // request is accepted until the claimed copy is finished.
+    bool take_snapshot(std::vector<OutlierRecord>& top, std::vector<OutlierRecord>& over_threshold);
+
+    // Offline (after the consumer has been joined)
+    std::vector<OutlierRecord> top() const;                 // slowest first
+    std::vector<OutlierRecord> over_threshold() const;      // oldest first
+    void dump(std::ostream& out, std::size_t max_rows = 20) const;
+
+    void reset() noexcept;
+
+    std::uint64_t threshold_hits() const noexcept { return threshold_hits_; }
+
+private:
+    static constexpr std::uint32_t kSnapIdle = 0;
+    static constexpr std::uint32_t kSnapRequested = 1;
+    static constexpr std::uint32_t kSnapReady = 2;
+    static constexpr std::uint32_t kSnapTaking = 3;     // a take_snapshot() caller is copying it out
+
+    void insert_top_(const OutlierRecord& r) noexcept;
+    void publish_snapshot_() noexcept;
+
+    const std::size_t top_k_;
+    const std::uint64_t threshold_ns_;
+    const std::size_t threshold_capacity_;
+
+    // Top-K min-heap by latency (size <= top_k_, capacity reserved up front)
+    std::vector<OutlierRecord> heap_;
+    std::uint64_t floor_ns_{0};                 // heap minimum once full; 0 while filling
+
+    // Threshold ring
+    std::unique_ptr<OutlierRecord[]> recent_;
+    std::size_t recent_idx_{0};
+    std::size_t recent_count_{0};
+    std::uint64_t threshold_hits_{0};
+
+    // On-demand snapshot (consumer writes, requester reads)
+    std::atomic<std::uint32_t> snap_state_{kSnapIdle};
+    std::vector<OutlierRecord> snap_top_;
+    std::vector<OutlierRecord> snap_recent_;
+};
+
+}//namespace spsc
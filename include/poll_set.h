@@ -0,0 +1,230 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "ring_buffer.h"
+
+namespace spsc {
+
+enum class PollPolicy : std::uint8_t { RoundRobin = 0, Priority = 1 };
+
+// A set of SPSC rings (one producer per ring) drained by a single consumer thread.
+// Producers flag a ring in a readiness bitmap after pushing; the consumer only visits flagged rings.
+// Bitmap words are one per cache line (64 rings each) so producers of different groups do not share lines.
+template <typename T>
+class PollSet final {
+public:
+    struct Options {
+        PollPolicy policy{PollPolicy::RoundRobin};
+
+        // Max events drained from one ring per visit (bounds the time one hot ring can hold the consumer)
+        std::size_t batch{32};
+
+        // Priority only: a ready ring skipped for this many consecutive polls is served first (0 = off)
+        std::uint64_t starvation_limit{0};
+    };
+
+    struct RingStats {
+        std::uint64_t consumed{0};
+        std::uint64_t starved_polls{0};         // polls where the ring was ready but got no budget
+        std::uint64_t max_starved_streak{0};    // longest run of consecutive starved polls
+    };
+
+    PollSet(std::size_t num_rings, std::size_t ring_capacity, Options opts = {})
+        : opts_(opts),
+          words_((num_rings + kBitsPerWord - 1) / kBitsPerWord),
+          snapshot_(words_.size(), 0),
+          stats_(num_rings),
+          streak_(num_rings, 0) {
+        rings_.reserve(num_rings);
+        for (std::size_t i = 0; i < num_rings; ++i) {
+            rings_.push_back(std::make_unique<SpscRingBuffer<T>>(ring_capacity));
+        }
+        if (opts_.batch == 0) opts_.batch = 1;
+    }
+
+    PollSet(const PollSet&) = delete;
+    PollSet& operator=(const PollSet&) = delete;
+
+    std::size_t size() const noexcept { return rings_.size(); }
+    const Options& options() const noexcept { return opts_; }
+
+    // ---- Producer side (ring i is owned by exactly one producer thread) ----
+
+    bool try_push(std::size_t i, const T& value) requires std::copy_constructible<T> {
+        if (!rings_[i]->try_push(value)) return false;
+        mark_ready_(i);
+        return true;
+    }
+
+    bool try_push(std::size_t i, T&& value) {
+        if (!rings_[i]->try_push(std::move(value))) return false;
+        mark_ready_(i);
+        return true;
+    }
+
+    // ---- Consumer side (single thread) ----
+
+    // Drain ready rings, calling handler(ring_index, value&) per event, up to `budget` events.
+    // Returns the number of events handled (0 when nothing was ready).
+    template <typename Handler>
+    std::size_t poll(Handler&& handler, std::size_t budget = std::numeric_limits<std::size_t>::max()) {
+        // Snapshot-and-clear: a producer pushing after this point re-flags its ring
+        for (std::size_t w = 0; w < words_.size(); ++w) {
+            snapshot_[w] = words_[w].bits.exchange(0, std::memory_order_seq_cst);
+        }
+
+        // Pairs with the fence in mark_ready_ (store-buffer pattern). Producer: push, fence, test
+        // bit. Consumer: clear bits, fence, read rings. Both fences are in the single total order,
+        // so if the producer's test still saw its bit set (and skipped fetch_or), this poll's ring
+        // reads see the push. Without it the ring loads (acquire) could be satisfied before the
+        // exchange, and a push could sit in a ring whose bit is clear: a lost wakeup.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::size_t handled = 0;
+
+        if (opts_.policy == PollPolicy::Priority && opts_.starvation_limit != 0) {
+            for_each_ready_(0, [&](std::size_t i) {
+                if (handled < budget && streak_[i] >= opts_.starvation_limit) {
+                    take_(i);
+                    handled += serve_(i, handler, budget - handled);
+                }
+            });
+        }
+
+        const std::size_t start = (opts_.policy == PollPolicy::RoundRobin) ? cursor_ : 0;
+
+        for_each_ready_(start, [&](std::size_t i) {
+            take_(i);
+            if (handled < budget) {
+                handled += serve_(i, handler, budget - handled);
+                cursor_ = (i + 1 == rings_.size()) ? 0 : i + 1;
+            }
+            else {
+                starve_(i);
+            }
+        });
+
+        return handled;
+    }
+
+    bool ready(std::size_t i) const noexcept {
+        return (words_[i / kBitsPerWord].bits.load(std::memory_order_acquire) >> (i % kBitsPerWord)) & 1u;
+    }
+
+    // Consumer-owned stats; read from the consumer thread or after it has stopped
+    const RingStats& stats(std::size_t i) const noexcept { return stats_[i]; }
+
+    // Zero stats and starvation streaks; only while the consumer isn't polling
+    void reset_stats() noexcept {
+        for (auto& s : stats_) s = RingStats{};
+        for (auto& s : streak_) s = 0;
+    }
+
+    SpscRingBuffer<T>& ring(std::size_t i) noexcept { return *rings_[i]; }
+
+private:
+    static constexpr std::size_t kBitsPerWord = 64;
+
+    struct alignas(kCacheLine) ReadyWord {
+        std::atomic<std::uint64_t> bits{0};
+    };
+
+    void mark_ready_(std::size_t i) noexcept {
+        auto& word = words_[i / kBitsPerWord].bits;
+        const std::uint64_t bit = std::uint64_t{1} << (i % kBitsPerWord);
+
+        // Pairs with the fence after the consumer's snapshot in poll(): either the consumer reads
+        // our push in this poll, or we see the bit cleared and set it again
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Test first so an already-flagged ring does not bounce the line between cores
+        if ((word.load(std::memory_order_relaxed) & bit) == 0) {
+            word.fetch_or(bit, std::memory_order_release);
+        }
+    }
+
+    // Visit set bits of the snapshot in ring order starting at `start`, wrapping around.
+    // Bits taken by an earlier pass (take_) are skipped. f may only take the bit it is given, so
+    // the word copied here stays accurate for the rest of the visit.
+    template <typename F>
+    void for_each_ready_(std::size_t start, F&& f) {
+        const std::size_t n_words = snapshot_.size();
+        if (n_words == 0) return;
+
+        const std::size_t first_word = start / kBitsPerWord;
+        const std::uint64_t high_mask = ~std::uint64_t{0} << (start % kBitsPerWord);
+
+        for (std::size_t k = 0; k <= n_words; ++k) {
+            const std::size_t w = (first_word + k) % n_words;
+
+            // First word: bits >= start; the wrap back onto it: bits < start
+            std::uint64_t mask = ~std::uint64_t{0};
+            if (k == 0) mask = high_mask;
+            else if (k == n_words) mask = ~high_mask;
+
+            std::uint64_t bits = snapshot_[w] & mask;
+            while (bits != 0) {
+                const std::size_t b = static_cast<std::size_t>(std::countr_zero(bits));
+                bits &= bits - 1;
+                f(w * kBitsPerWord + b);
+            }
+        }
+    }
+
+    void take_(std::size_t i) noexcept {
+        snapshot_[i / kBitsPerWord] &= ~(std::uint64_t{1} << (i % kBitsPerWord));
+    }
+
+    template <typename Handler>
+    std::size_t serve_(std::size_t i, Handler& handler, std::size_t budget) {
+        SpscRingBuffer<T>& rb = *rings_[i];
+        const std::size_t limit = budget < opts_.batch ? budget : opts_.batch;
+
+        std::size_t n = 0;
+        T value{};
+        while (n < limit && rb.try_pop(value)) {
+            handler(i, value);
+            ++n;
+        }
+
+        stats_[i].consumed += n;
+        streak_[i] = 0;
+
+        // Hit the batch limit: leave the ring flagged for the next poll
+        if (n == limit && !rb.empty()) {
+            words_[i / kBitsPerWord].bits.fetch_or(std::uint64_t{1} << (i % kBitsPerWord),
+                                                   std::memory_order_relaxed);
+        }
+        return n;
+    }
+
+    void starve_(std::size_t i) noexcept {
+        RingStats& s = stats_[i];
+        ++s.starved_polls;
+        if (++streak_[i] > s.max_starved_streak) s.max_starved_streak = streak_[i];
+
+        // Still has data: put its flag back
+        words_[i / kBitsPerWord].bits.fetch_or(std::uint64_t{1} << (i % kBitsPerWord),
+                                               std::memory_order_relaxed);
+    }
+
+    Options opts_;
+    std::vector<std::unique_ptr<SpscRingBuffer<T>>> rings_;
+    std::vector<ReadyWord> words_;
+
+    // Consumer-only state
+    std::vector<std::uint64_t> snapshot_;
+    std::vector<RingStats> stats_;
+    std::vector<std::uint64_t> streak_;
+    std::size_t cursor_{0};
+};
+
+}//namespace spsc
@@ -3,6 +3,7 @@
 #include <atomic> 
 #include <cstddef> 
 #include <cstdint> 
+#include <cstring> 
 #include <memory> 
 #include <new>
 #include <type_traits> 
@@ -37,7 +38,7 @@ public:
     explicit SpscRingBuffer(std::size_t requested_capacity) 
         : capacity_(spsc::round_up_pow2(requested_capacity)),
           mask_(capacity_ - 1),
-          storage_(std::make_unique<spsc::Storage<T>[]>(capacity_)) {
+          storage_(std::make_unique_for_overwrite<spsc::Storage<T>[]>(capacity_)) {
         head_.store(0, std::memory_order_relaxed);
         tail_.store(0, std::memory_order_relaxed); 
     } 
@@ -49,6 +50,12 @@ public:
 
     std::size_t capacity() const noexcept { return capacity_; }
 
+    // Touch every page of slot storage from the calling thread (first-touch NUMA placement, no
+    // page faults on the hot path). Storage is left untouched until then. Only call while empty.
+    void prefault() noexcept {
+        std::memset(static_cast<void*>(storage_.get()), 0, capacity_ * sizeof(spsc::Storage<T>));
+    }
+
     bool try_push(const T& value) requires std::copy_constructible<T> { return emplace_(value); }
     bool try_push(T&& value) {return emplace_(std::move(value)); } 
     
@@ -73,6 +80,13 @@ public:
         return head == tail; 
     }
 
+    // Approximate when called concurrently with the other side; exact from either side when it is idle
+    std::size_t size() const noexcept {
+        const auto tail = tail_.load(std::memory_order_acquire);
+        const auto head = head_.load(std::memory_order_acquire); 
+        return static_cast<std::size_t>(head - tail);
+    }
+
     bool full() const noexcept {
         const auto tail = tail_.load(std::memory_order_acquire);
         const auto head = head_.load(std::memory_order_acquire); 
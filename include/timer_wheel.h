@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace spsc {
+
+// Hierarchical hashed timer wheel: 4 levels x 256 slots over ticks of (1 << tick_shift) ns.
+// Driven entirely by timestamps passed to advance(); it never reads a clock itself.
+//  - schedule / cancel are O(1); nodes come from a fixed pool allocated at construction
+//  - advance() skips empty slots via per-level occupancy bitmaps and cascades on level rollover
+//  - single-threaded (owned by the consumer thread)
+class TimerWheel final {
+public:
+    using Callback = void (*)(void* ctx, std::uint64_t arg, std::uint64_t now_ns);
+
+    // Opaque handle: pool index + generation. Stale handles are rejected by cancel().
+    using TimerId = std::uint64_t;
+    static constexpr TimerId kInvalidTimer = 0;
+
+    static constexpr unsigned kLevels = 4;
+    static constexpr unsigned kSlotBits = 8;
+    static constexpr std::size_t kSlots = std::size_t{1} << kSlotBits;
+
+    // tick_shift 10 => ~1us ticks, 2^32 ticks (~73 min) before the top level clamps
+    TimerWheel(std::size_t max_timers, std::uint64_t start_ns, unsigned tick_shift = 10);
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // Fires on the first advance() with now >= deadline (rounded up to a tick).
+    // Returns kInvalidTimer when the pool is exhausted.
+    TimerId schedule_at(std::uint64_t deadline_ns, Callback fn, void* ctx, std::uint64_t arg = 0) noexcept;
+
+    TimerId schedule_after(std::uint64_t delay_ns, Callback fn, void* ctx, std::uint64_t arg = 0) noexcept {
+        return schedule_at(now_ns_ + delay_ns, fn, ctx, arg);
+    }
+
+    // False if the timer already fired, was cancelled, or the handle is stale
+    bool cancel(TimerId id) noexcept;
+
+    // Run every timer due at or before now_ns. Returns the number fired.
+    std::size_t advance(std::uint64_t now_ns) noexcept;
+
+    // Drop every timer (handles become stale) and restart the wheel at start_ns. O(capacity).
+    void reset(std::uint64_t start_ns) noexcept;
+
+    std::size_t active() const noexcept { return active_; }
+    std::size_t capacity() const noexcept { return capacity_; }
+    std::uint64_t now_ns() const noexcept { return now_ns_; }
+
+private:
+    static constexpr std::uint32_t kNil = ~std::uint32_t{0};
+    static constexpr std::size_t kWordsPerLevel = kSlots / 64;
+
+    struct Node {
+        std::uint64_t expiry_tick{0};
+        Callback fn{nullptr};
+        void* ctx{nullptr};
+        std::uint64_t arg{0};
+        std::uint32_t prev{kNil};
+        std::uint32_t next{kNil};           // also the free-list link
+        std::uint32_t gen{1};
+        std::uint16_t slot{0};
+        std::uint8_t level{0};
+        bool active{false};
+    };
+
+    void insert_(std::uint32_t idx) noexcept;
+    void unlink_(std::uint32_t idx) noexcept;
+    void release_(std::uint32_t idx) noexcept;
+    void cascade_(unsigned level, std::size_t slot) noexcept;
+    std::size_t expire_(std::size_t slot, std::uint64_t now_ns) noexcept;
+    std::size_t next_occupied_(unsigned level, std::size_t from) const noexcept;
+    std::uint64_t next_work_tick_() const noexcept;
+
+    const std::size_t capacity_;
+    const unsigned tick_shift_;
+
+    std::unique_ptr<Node[]> nodes_;
+    std::uint32_t free_head_{kNil};
+    std::size_t active_{0};
+
+    std::uint64_t tick_{0};                 // last processed tick
+    std::uint64_t now_ns_{0};               // last timestamp passed to advance()
+
+    std::array<std::array<std::uint32_t, kSlots>, kLevels> heads_{};
+    std::array<std::array<std::uint64_t, kWordsPerLevel>, kLevels> occupied_{};
+};
+
+}//namespace spsc
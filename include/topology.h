@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "event_bus.h"
+
+namespace spsc {
+
+// Declarative description of a set of buses, parsed from an INI-style file:
+//
+//   [runtime]
+//   warmup_events = 300000        # pushed through every bus during startup, then discarded
+//   events        = 5000000       # measured run length per bus
+//   trace_file    = trace.json    # Chrome trace of sampled hops (needs SPSC_TRACING)
+//
+//   [bus md]                      # one section per bus: ring + producer + consumer
+//   ring_capacity       = 65536
+//   max_latency_samples = 1048576
+//   producer_core       = 2       # -1 = unpinned
+//   consumer_core       = 3
+//   wait                = spin | spin_yield | yield
+//   memory              = lazy | prefault
+//   trace_sample_every  = 1024    # 0 = no tracing on this bus
+//   trace_capacity      = 65536
+//   outlier_top_k              = 32       # slowest events kept with context
+//   outlier_threshold_ns       = 50000    # also keep recent events above this (0 = off)
+//   outlier_threshold_capacity = 1024
+//   heartbeat_every_ns         = 1000000  # consumer-loop timer wheel (0 = off)
+//   stale_after_ns             = 50000000 # instrument with no event for this long is stale (0 = off)
+//   max_instruments            = 65536
+//   round_trip          = false   # consumer echoes on a reply ring; producer measures RTT/2
+//   in_flight           = 1       # round-trip window (unanswered events)
+//   think_ns            = 0       # round-trip pause after each reply
+//   udp_listen          = 239.1.1.1:30001  # producer ingests this UDP feed instead (not warmed up;
+//                                          # needs events > 0, the run ends after that many)
+//   udp_batch           = 32      # datagrams per recvmmsg (udp_* keys need SPSC_UDP_INGEST)
+//
+// Parse errors throw std::runtime_error naming the line. Capacities (ring, latency samples, trace,
+// in_flight) must be in [1, 2^30], and in_flight must not exceed ring_capacity.
+struct TopologyConfig {
+    struct Bus {
+        std::string name;
+        EventBus::Options options;
+    };
+
+    std::uint64_t warmup_events{0};
+    std::uint64_t events{0};
+    std::string trace_file;
+    std::vector<Bus> buses;
+
+    static TopologyConfig parse(std::istream& in);
+    static TopologyConfig load(const std::string& path);
+};
+
+
+// Builds every bus in one startup phase: allocate, launch (pin + prefault + park threads), warm up.
+// After construction all threads are parked and ready; start()/join() reuse them.
+class Topology final {
+public:
+    struct ReadyReport {
+        std::uint64_t build_ns{0};          // construct rings / trackers
+        std::uint64_t launch_ns{0};         // spawn, pin, prefault, park
+        std::uint64_t warmup_ns{0};         // warmup stream through every bus
+        std::uint64_t total_ns{0};          // time-to-ready
+    };
+
+    explicit Topology(TopologyConfig config);
+
+    Topology(const Topology&) = delete;
+    Topology& operator=(const Topology&) = delete;
+
+    // Start / join every bus (all run concurrently)
+    void start(std::uint64_t target_events);
+    void join();
+
+    // Chrome trace JSON of every bus (one process per bus). After join.
+    void write_trace(std::ostream& out) const;
+
+    const ReadyReport& ready_report() const noexcept { return ready_; }
+    const TopologyConfig& config() const noexcept { return config_; }
+
+    std::size_t size() const noexcept { return buses_.size(); }
+    EventBus& bus(std::size_t i) noexcept { return *buses_[i]; }
+    const std::string& name(std::size_t i) const noexcept { return config_.buses[i].name; }
+
+private:
+    TopologyConfig config_;
+    std::vector<std::unique_ptr<EventBus>> buses_;
+    ReadyReport ready_{};
+};
+
+}//namespace spsc
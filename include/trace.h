@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+
+// Compile-time switch for per-hop tracing in EventBus (CMake option LLEB_ENABLE_TRACING).
+// When 0, the hot loops contain no tracing code at all.
+#ifndef SPSC_TRACING
+#define SPSC_TRACING 0
+#endif
+
+namespace spsc {
+
+// Where an event spends its time:
+//   Produce: generated -> successfully pushed (includes backpressure on a full ring)
+//   Ring:    pushed (enqueue_ns) -> popped
+//   Handle:  popped -> consumer handler done
+enum class Hop : std::uint8_t { Produce = 0, Ring = 1, Handle = 2 };
+
+inline constexpr std::size_t kHopCount = 3;
+
+const char* hop_name(Hop hop) noexcept;
+
+struct TraceSpan {
+    std::uint64_t seq{0};
+    std::uint64_t begin_ns{0};
+    std::uint64_t end_ns{0};
+    Hop hop{Hop::Produce};
+};
+
+// Fixed-capacity span buffer owned by one thread. No locks, no allocations after construction;
+// keeps the most recent `capacity` spans (ring semantics, like LatencyTracker).
+// Read only after the writing thread has been joined.
+class TraceBuffer final {
+public:
+    explicit TraceBuffer(std::size_t capacity);
+
+    TraceBuffer(const TraceBuffer&) = delete;
+    TraceBuffer& operator=(const TraceBuffer&) = delete;
+
+    // Hot path (writer thread only)
+    void record(Hop hop, std::uint64_t seq, std::uint64_t begin_ns, std::uint64_t end_ns) noexcept {
+        spans_[write_idx_] = TraceSpan{seq, begin_ns, end_ns, hop};
+        write_idx_ = (write_idx_ + 1 == capacity_) ? 0 : write_idx_ + 1;
+        if (count_ < capacity_) ++count_;
+        else ++overwritten_;
+    }
+
+    void clear() noexcept { write_idx_ = 0; count_ = 0; overwritten_ = 0; }
+
+    // i = 0 is the oldest kept span
+    const TraceSpan& operator[](std::size_t i) const noexcept {
+        const std::size_t first = (count_ < capacity_) ? 0 : write_idx_;
+        return spans_[(first + i) % capacity_];
+    }
+
+    std::size_t size() const noexcept { return count_; }
+    std::size_t capacity() const noexcept { return capacity_; }
+    std::uint64_t overwritten() const noexcept { return overwritten_; }
+
+private:
+    const std::size_t capacity_;
+    std::unique_ptr<TraceSpan[]> spans_;
+
+    std::size_t write_idx_{0};
+    std::size_t count_{0};
+    std::uint64_t overwritten_{0};
+};
+
+// Streams Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev).
+// Each hop gets its own track per pid: producer / ring transit / consumer.
+class ChromeTraceWriter final {
+public:
+    explicit ChromeTraceWriter(std::ostream& out);
+    ~ChromeTraceWriter();
+
+    ChromeTraceWriter(const ChromeTraceWriter&) = delete;
+    ChromeTraceWriter& operator=(const ChromeTraceWriter&) = delete;
+
+    // Name the process (one per bus) and its hop tracks
+    void add_process(std::uint32_t pid, const char* name);
+
+    void add(const TraceBuffer& buffer, std::uint32_t pid);
+
+private:
+    void begin_event_();
+
+    std::ostream& out_;
+    bool first_{true};
+};
+
+}//namespace spsc
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "event.h"
+#include "feed_packet.h"
+
+struct mmsghdr;
+struct iovec;
+
+namespace spsc {
+
+// Batched UDP feed receiver (Linux): one non-blocking recvmmsg per receive() call into
+// preallocated buffers. Endpoint is "host:port" (port 0 = ephemeral); a multicast host joins the
+// group on the default interface.
+//
+// Packets carry a receive timestamp on the LatencyTracker::now_ns() clock: the kernel's
+// SO_TIMESTAMPNS RX stamp when the socket delivers one (converted from CLOCK_REALTIME once per
+// batch), otherwise the time recvmmsg returned.
+class UdpIngest final {
+public:
+    struct Packet {
+        const std::byte* data{nullptr};
+        std::size_t len{0};
+        std::uint64_t rx_ns{0};
+    };
+
+    // Throws std::system_error if the socket can't be created, configured or bound
+    explicit UdpIngest(const std::string& endpoint, std::size_t batch = 32, int rcvbuf_bytes = 4 << 20);
+    ~UdpIngest();
+
+    UdpIngest(const UdpIngest&) = delete;
+    UdpIngest& operator=(const UdpIngest&) = delete;
+
+    // Hot path: receive up to batch() datagrams without blocking. Returns the number received;
+    // they stay valid via packet(i) until the next receive().
+    std::size_t receive() noexcept;
+
+    Packet packet(std::size_t i) const noexcept { return packets_[i]; }
+
+    // True once any datagram arrived with a kernel RX timestamp
+    bool kernel_timestamps() const noexcept { return kernel_ts_; }
+
+    std::uint16_t port() const noexcept { return port_; }
+    std::size_t batch() const noexcept { return batch_; }
+
+    // Touch the receive buffers from the calling thread (see SpscRingBuffer::prefault)
+    void prefault() noexcept;
+
+private:
+    static constexpr std::size_t kControlLen = 64;      // one SCM_TIMESTAMPNS cmsg
+
+    int fd_{-1};
+    std::uint16_t port_{0};
+    const std::size_t batch_;
+    bool kernel_ts_{false};
+
+    std::unique_ptr<std::byte[]> data_;                 // batch_ x kMaxDatagram
+    std::unique_ptr<std::byte[]> control_;              // batch_ x kControlLen
+    std::unique_ptr<iovec[]> iov_;
+    std::unique_ptr<mmsghdr[]> msgs_;
+    std::unique_ptr<Packet[]> packets_;
+};
+
+
+// Test / benchmark feed source: synthetic events packed into wire packets and sent with sendmmsg.
+// Event and packet sequence numbers continue across send() calls.
+class UdpSender final {
+public:
+    // Throws std::system_error on socket / address errors
+    explicit UdpSender(const std::string& endpoint, std::size_t batch = 32);
+    ~UdpSender();
+
+    UdpSender(const UdpSender&) = delete;
+    UdpSender& operator=(const UdpSender&) = delete;
+
+    // Send `packets` datagrams of events_per_packet events (capped at wire::kMaxEventsPerPacket),
+    // in sendmmsg batches paced at least gap_ns apart per packet. Returns the datagrams sent;
+    // ones still refused after kMaxSendRetries backed-off attempts are dropped and counted instead.
+    std::uint64_t send(std::uint64_t packets, std::size_t events_per_packet, std::uint64_t gap_ns = 0);
+
+    static constexpr unsigned kMaxSendRetries = 16;
+
+    std::uint64_t events_sent() const noexcept { return next_seq_; }            // including dropped
+    std::uint64_t packets_sent() const noexcept { return next_packet_ - dropped_; }
+    std::uint64_t packets_dropped() const noexcept { return dropped_; }
+
+private:
+    int fd_{-1};
+    const std::size_t batch_;
+    std::uint64_t next_seq_{0};
+    std::uint64_t next_packet_{0};
+    std::uint64_t dropped_{0};
+
+    std::unique_ptr<std::byte[]> data_;
+    std::unique_ptr<iovec[]> iov_;
+    std::unique_ptr<mmsghdr[]> msgs_;
+};
+
+}//namespace spsc
@@ -0,0 +1,72 @@
+#include "bus_workers.h"
+
+
+#include <cstddef>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+namespace spsc {
+
+namespace detail {
+
+void pin_current_thread(int core) noexcept {
+#if defined(__linux__)
+    if (core < 0) return;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);     // best effort
+#else
+    (void)core;
+#endif
+}
+
+// Fault in the top of the calling thread's stack so deep calls on the hot path don't page fault
+void prefault_stack() noexcept {
+    constexpr std::size_t kBytes = 64 * 1024;
+    volatile unsigned char buf[kBytes];
+    for (std::size_t i = 0; i < kBytes; i += 4096) {
+        buf[i] = 0;
+    }
+    (void)buf[0];
+}
+
+}//namespace detail
+
+
+void BusWorkers::start() noexcept {
+    finished_.store(0, std::memory_order_relaxed);
+    run_gen_.fetch_add(1, std::memory_order_release);
+    run_gen_.notify_all();
+}
+
+void BusWorkers::join() noexcept {
+    for (auto n = finished_.load(std::memory_order_acquire); n < 2; n = finished_.load(std::memory_order_acquire)) {
+        finished_.wait(n, std::memory_order_acquire);
+    }
+}
+
+void BusWorkers::shutdown() noexcept {
+    if (!launched_) {
+        return;
+    }
+
+    shutdown_.store(true, std::memory_order_release);
+    run_gen_.fetch_add(1, std::memory_order_acq_rel);
+    run_gen_.notify_all();
+
+    if (producer_.joinable()) producer_.join();
+    if (consumer_.joinable()) consumer_.join();
+
+    // Ready for another launch()
+    launched_ = false;
+    shutdown_.store(false, std::memory_order_relaxed);
+    parked_.store(0, std::memory_order_relaxed);
+}
+
+}//namespace spsc
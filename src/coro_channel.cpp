@@ -0,0 +1,138 @@
+#include "coro_channel.h"
+
+
+#include <new>
+
+
+namespace spsc {
+
+void FramePool::reserve(std::size_t blocks) {
+    if (blocks > blocks_) {
+        grow_(blocks - blocks_);
+    }
+}
+
+void FramePool::grow_(std::size_t blocks) {
+    // Blocks inherit operator new[] alignment (__STDCPP_DEFAULT_NEW_ALIGNMENT__), same as frames
+    auto chunk = std::make_unique<std::byte[]>(blocks * kBlockSize);
+
+    for (std::size_t i = 0; i < blocks; ++i) {
+        auto* node = ::new (static_cast<void*>(chunk.get() + i * kBlockSize)) FreeNode{free_};
+        free_ = node;
+    }
+
+    chunks_.push_back(std::move(chunk));
+    blocks_ += blocks;
+}
+
+void* FramePool::allocate(std::size_t n) {
+    if (n > kBlockSize) {
+        ++oversized_;
+        return ::operator new(n);
+    }
+
+    if (free_ == nullptr) {
+        grow_(kBlocksPerChunk);
+    }
+
+    FreeNode* node = free_;
+    free_ = node->next;
+    ++in_use_;
+    return node;
+}
+
+void FramePool::deallocate(void* p, std::size_t n) noexcept {
+    if (n > kBlockSize) {
+        ::operator delete(p, n);
+        return;
+    }
+
+    free_ = ::new (p) FreeNode{free_};
+    --in_use_;
+}
+
+
+void PollScheduler::WaitList::push_back(Waiter* w) noexcept {
+    w->prev = tail_;
+    w->next = nullptr;
+    w->list = this;
+
+    if (tail_ != nullptr) {
+        tail_->next = w;
+    }
+    else {
+        head_ = w;
+    }
+
+    tail_ = w;
+    ++size_;
+}
+
+PollScheduler::Waiter* PollScheduler::WaitList::pop_front() noexcept {
+    Waiter* w = head_;
+    if (w != nullptr) remove(w);
+    return w;
+}
+
+void PollScheduler::WaitList::remove(Waiter* w) noexcept {
+    if (w->prev != nullptr) w->prev->next = w->next;
+    else head_ = w->next;
+
+    if (w->next != nullptr) w->next->prev = w->prev;
+    else tail_ = w->prev;
+
+    w->prev = nullptr;
+    w->next = nullptr;
+    w->list = nullptr;
+    --size_;
+}
+
+void PollScheduler::WaitList::splice(WaitList& other) noexcept {
+    while (Waiter* w = other.pop_front()) {
+        push_back(w);
+    }
+}
+
+void PollScheduler::WaitList::clear() noexcept {
+    while (pop_front() != nullptr) {}
+}
+
+
+PollScheduler::~PollScheduler() {
+    // Tasks still parked here must not unlink from a dead scheduler later
+    queue_.clear();
+    polling_.clear();
+}
+
+void PollScheduler::spawn(Task& task) {
+    if (!task.done()) {
+        task.handle().resume();
+    }
+}
+
+void PollScheduler::enqueue(Waiter* w) noexcept {
+    queue_.push_back(w);
+}
+
+std::size_t PollScheduler::poll() noexcept {
+    // Work through the waiters queued so far; resumed coroutines that suspend again re-enqueue on
+    // queue_ and wait for the next pass. A resumed coroutine may destroy other parked tasks: their
+    // waiters unlink from polling_ and are simply never visited.
+    polling_.splice(queue_);
+
+    std::size_t resumed = 0;
+
+    while (Waiter* w = polling_.pop_front()) {
+        if (w->ready(w->source)) {
+            w->handle.resume();
+            ++resumed;
+        }
+        else {
+            queue_.push_back(w);
+        }
+    }
+
+    return resumed;
+}
+
+}//namespace spsc
@@ -0,0 +1,83 @@
+#include "feed_monitor.h"
+
+
+namespace spsc {
+
+FeedMonitor::FeedMonitor(TimerWheel& wheel, std::size_t max_instruments,
+                         std::uint64_t stale_after_ns, std::uint64_t heartbeat_every_ns, Hooks hooks)
+    : wheel_(wheel),
+      max_instruments_(max_instruments),
+      stale_after_ns_(stale_after_ns),
+      heartbeat_every_ns_(heartbeat_every_ns),
+      hooks_(hooks),
+      last_seen_(std::make_unique<std::uint64_t[]>(max_instruments)),
+      armed_(std::make_unique<bool[]>(max_instruments)) {}
+
+void FeedMonitor::start() noexcept {
+    if (heartbeat_every_ns_ != 0) {
+        next_heartbeat_ns_ = wheel_.now_ns() + heartbeat_every_ns_;
+        arm_heartbeat_();
+    }
+}
+
+void FeedMonitor::reset() noexcept {
+    for (std::size_t i = 0; i < max_instruments_; ++i) {
+        last_seen_[i] = 0;
+        armed_[i] = false;
+    }
+    next_heartbeat_ns_ = 0;
+    heartbeats_ = 0;
+    stale_events_ = 0;
+    pool_exhausted_ = 0;
+}
+
+void FeedMonitor::arm_heartbeat_() noexcept {
+    if (wheel_.schedule_at(next_heartbeat_ns_, &FeedMonitor::heartbeat_cb_, this) == TimerWheel::kInvalidTimer) {
+        ++pool_exhausted_;
+    }
+}
+
+void FeedMonitor::arm_(std::uint32_t instrument_id, std::uint64_t deadline_ns) noexcept {
+    if (wheel_.schedule_at(deadline_ns, &FeedMonitor::stale_cb_, this, instrument_id) == TimerWheel::kInvalidTimer) {
+        ++pool_exhausted_;
+        return;
+    }
+    armed_[instrument_id] = true;
+}
+
+void FeedMonitor::heartbeat_cb_(void* ctx, std::uint64_t, std::uint64_t now_ns) {
+    auto* self = static_cast<FeedMonitor*>(ctx);
+
+    ++self->heartbeats_;
+    if (self->hooks_.on_heartbeat != nullptr) {
+        self->hooks_.on_heartbeat(self->hooks_.ctx, now_ns);
+    }
+
+    // Next beat on the fixed schedule, not relative to this (possibly late) firing; skip missed beats
+    self->next_heartbeat_ns_ += self->heartbeat_every_ns_;
+    if (self->next_heartbeat_ns_ <= now_ns) {
+        self->next_heartbeat_ns_ = now_ns + self->heartbeat_every_ns_;
+    }
+    self->arm_heartbeat_();
+}
+
+void FeedMonitor::stale_cb_(void* ctx, std::uint64_t arg, std::uint64_t now_ns) {
+    auto* self = static_cast<FeedMonitor*>(ctx);
+    const auto id = static_cast<std::uint32_t>(arg);
+    const std::uint64_t last_seen = self->last_seen_[id];
+
+    self->armed_[id] = false;
+
+    if (now_ns - last_seen >= self->stale_after_ns_) {
+        // Stale: stays disarmed until the instrument ticks again
+        ++self->stale_events_;
+        if (self->hooks_.on_stale != nullptr) {
+            self->hooks_.on_stale(self->hooks_.ctx, id, last_seen, now_ns);
+        }
+    }
+    else {
+        self->arm_(id, last_seen + self->stale_after_ns_);
+    }
+}
+
+}//namespace spsc
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <chrono> 
 #include <cmath> 
+#include <cstring> 
 #include <vector> 
 
 
@@ -11,7 +12,7 @@ namespace spsc {
 
 LatencyTracker::LatencyTracker(std::size_t max_samples) 
     : capacity_(max_samples), 
-      samples_(std::make_unique<std::uint32_t[]>(max_samples)) {
+      samples_(std::make_unique_for_overwrite<std::uint32_t[]>(max_samples)) {
     
     reset(); 
 }
@@ -22,6 +23,10 @@ void LatencyTracker::reset() noexcept {
     sum_ns_ = 0; 
 }
 
+void LatencyTracker::prefault() noexcept {
+    std::memset(samples_.get(), 0, capacity_ * sizeof(std::uint32_t)); 
+}
+
 void LatencyTracker::record_ns(std::uint64_t latency_ns) noexcept {
     // Clamp to uint32_t range (defensive, should not happen in practice)
     const std::uint32_t v = 
@@ -1,12 +1,17 @@
 #include <chrono>
 #include <cstdint> 
+#include <exception> 
+#include <fstream> 
 #include <iomanip>
 #include <iostream> 
 
 
 #include "event_bus.h"
+#include "topology.h"
 
-int main() {
+// Usage: benchmark [topology.conf]
+// Without a config file, runs a single bus with the defaults below.
+int main(int argc, char** argv) {
     
     //Tunables (start conservative; bump for real benchmarking) 
     constexpr std::size_t kRingCapacity = 1 << 16;          // 65,536 events
@@ -14,30 +19,41 @@ int main() {
     constexpr std::uint64_t kNumEvents  = 5'000'000;        // target events to publish 
     constexpr std::uint64_t kWarmupEvents = 300'000;        // warmup (not measured)
 
-    spsc::EventBus bus{kRingCapacity, kMaxSamples}; 
+    spsc::TopologyConfig config{}; 
 
+    if (argc > 1) {
+        try {
+            config = spsc::TopologyConfig::load(argv[1]); 
+        }
+        catch (const std::exception& ex) {
+            std::cerr << ex.what() << "\n"; 
+            return 1; 
+        }
+    }
+    else {
+        spsc::EventBus::Options opts{}; 
+        opts.ring_capacity = kRingCapacity; 
+        opts.max_latency_samples = kMaxSamples; 
 
-    // Warmup run (ignore stats)
-    bus.start(kWarmupEvents); 
-    bus.join(); 
+        config.warmup_events = kWarmupEvents; 
+        config.events = kNumEvents; 
+        config.buses.push_back({"default", opts}); 
+    }
+
+    // Startup phase: build, launch (pin + prefault), warmup (stats discarded)
+    spsc::Topology topo{config}; 
+    const auto& ready = topo.ready_report(); 
 
 
     // Measured run 
     const auto t0 = std::chrono::steady_clock::now(); 
-    bus.start(kNumEvents); 
-    bus.join();
+    topo.start(config.events); 
+    topo.join();
     const auto t1 = std::chrono::steady_clock::now(); 
 
 
     const std::chrono::duration<double> elapsed = t1 - t0; 
-
-
-    const auto stats = bus.latency_stats(); 
-    const auto ctrs = bus.counters(); 
-
-
     const double secs = elapsed.count(); 
-    const double throughput = secs > 0.0 ? (static_cast<double>(ctrs.consumed) / secs) : 0.0; 
 
 
     auto ns_to_us = [](std::uint64_t ns) -> double {
@@ -46,26 +62,81 @@ int main() {
 
 
     std::cout << "=== LowLatencyEventBus Benchmark ===\n"; 
-    std::cout << "Ring capcity:         " << kRingCapacity << "\n"; 
-    std::cout << "Target events:        " << kNumEvents << "\n"; 
-    std::cout << "Consumed:             " << ctrs.consumed << "\n"; 
-    std::cout << "Elapsed:              " << std::fixed << std::setprecision(6) << secs << "s\n";
-    std::cout << "Throughput            " << std::fixed << std::setprecision(0) << throughput << " events/sec\n\n"; 
+    std::cout << "Buses:                " << topo.size() << "\n"; 
+    std::cout << "Time to ready:        " << std::fixed << std::setprecision(3) << ns_to_us(ready.total_ns) / 1000.0 << "ms"
+              << " (build " << ns_to_us(ready.build_ns) / 1000.0 
+              << "ms, launch " << ns_to_us(ready.launch_ns) / 1000.0 
+              << "ms, warmup " << ns_to_us(ready.warmup_ns) / 1000.0 << "ms)\n"; 
+    std::cout << "Elapsed:              " << std::fixed << std::setprecision(6) << secs << "s\n\n";
+
+    for (std::size_t i = 0; i < topo.size(); ++i) {
+        const spsc::EventBus& bus = topo.bus(i); 
+        const auto stats = bus.latency_stats(); 
+        const auto ctrs = bus.counters(); 
+        const double throughput = secs > 0.0 ? (static_cast<double>(ctrs.consumed) / secs) : 0.0; 
+
+        std::cout << "--- bus " << topo.name(i) << " ---\n"; 
+        std::cout << "Ring capcity:         " << bus.options().ring_capacity << "\n"; 
+        std::cout << "Target events:        " << config.events << "\n"; 
+        std::cout << "Consumed:             " << ctrs.consumed << "\n"; 
+        std::cout << "Throughput            " << std::fixed << std::setprecision(0) << throughput << " events/sec\n"; 
+#if SPSC_UDP_INGEST
+        if (bus.ingest() != nullptr) {
+            const double pps = secs > 0.0 ? (static_cast<double>(ctrs.packets) / secs) : 0.0; 
+            std::cout << "UDP packets           " << ctrs.packets << " (" << std::fixed << std::setprecision(0) << pps << " pkts/sec, "
+                      << ctrs.packet_gaps << " lost, " << ctrs.bad_packets << " bad)\n"; 
+            std::cout << "Latency source        " << (bus.ingest()->kernel_timestamps() ? "kernel RX timestamp" : "recvmmsg return")
+                      << " -> dequeue\n"; 
+        }
+#endif
+        std::cout << "\n"; 
     
-    std::cout << "Latency samples kept: " << stats.count << "\n"; 
-    std::cout << "Latency (us):\n"; 
-    std::cout << "   min   " << stats.min_ns << "ns (" << std::fixed << std::setprecision(3) << ns_to_us(stats.min_ns) << "us)\n";
-    std::cout << "   p50   " << stats.p50_ns << "ns (" << std::fixed << std::setprecision(3) << ns_to_us(stats.p50_ns) << "us)\n";
-    std::cout << "   p90   " << stats.p99_ns << "ns (" << std::fixed << std::setprecision(3) << ns_to_us(stats.p99_ns) << "us)\n";
-    std::cout << "   p999  " << stats.p999_ns << "ns ("<< std::fixed << std::setprecision(3) << ns_to_us(stats.p999_ns) << "us)\n";
-    std::cout << "   max   " << stats.max_ns << "ns ("<< std::fixed << std::setprecision(3) << ns_to_us(stats.max_ns) << "us)\n";
-    std::cout << "   mean  " << stats.mean_ns << "ns ("<< std::fixed << std::setprecision(3) << ns_to_us(static_cast<std::uint64_t>(stats.mean_ns)) << "us)\n\n";
+        std::cout << "Latency samples kept: " << stats.count << "\n"; 
+        std::cout << "Latency (us):\n"; 
+        std::cout << "   min   " << stats.min_ns << "ns (" << std::fixed << std::setprecision(3) << ns_to_us(stats.min_ns) << "us)\n";
+        std::cout << "   p50   " << stats.p50_ns << "ns (" << std::fixed << std::setprecision(3) << ns_to_us(stats.p50_ns) << "us)\n";
+        std::cout << "   p90   " << stats.p99_ns << "ns (" << std::fixed << std::setprecision(3) << ns_to_us(stats.p99_ns) << "us)\n";
+        std::cout << "   p999  " << stats.p999_ns << "ns ("<< std::fixed << std::setprecision(3) << ns_to_us(stats.p999_ns) << "us)\n";
+        std::cout << "   max   " << stats.max_ns << "ns ("<< std::fixed << std::setprecision(3) << ns_to_us(stats.max_ns) << "us)\n";
+        std::cout << "   mean  " << stats.mean_ns << "ns ("<< std::fixed << std::setprecision(3) << ns_to_us(static_cast<std::uint64_t>(stats.mean_ns)) << "us)\n\n";
+
+        // Round trip: RTT/2 from the producer's clock alongside the cross-core one-way numbers
+        const auto rtt = bus.rtt_half_stats(); 
+        if (rtt.count > 0) {
+            std::cout << "Round trip (in flight " << bus.options().in_flight << ", think " << bus.options().think_ns << "ns), ns:\n"; 
+            std::cout << "             one-way    RTT/2\n"; 
+            std::cout << "   min   " << std::setw(10) << stats.min_ns << std::setw(9) << rtt.min_ns << "\n"; 
+            std::cout << "   p50   " << std::setw(10) << stats.p50_ns << std::setw(9) << rtt.p50_ns << "\n"; 
+            std::cout << "   p99   " << std::setw(10) << stats.p99_ns << std::setw(9) << rtt.p99_ns << "\n"; 
+            std::cout << "   p999  " << std::setw(10) << stats.p999_ns << std::setw(9) << rtt.p999_ns << "\n"; 
+            std::cout << "   max   " << std::setw(10) << stats.max_ns << std::setw(9) << rtt.max_ns << "\n\n"; 
+        }
+
+        const auto hops = bus.hop_stats(); 
+        if (hops.produce.count > 0) {
+            std::cout << "Per-hop latency, sampled (p50 / p99 / p999 ns):\n"; 
+            std::cout << "   produce  " << hops.produce.p50_ns << " / " << hops.produce.p99_ns << " / " << hops.produce.p999_ns << "\n"; 
+            std::cout << "   handle   " << hops.handle.p50_ns << " / " << hops.handle.p99_ns << " / " << hops.handle.p999_ns << "\n\n"; 
+        }
     
-    std::cout << "Counters:\n";
-    std::cout << "   produced:          " << ctrs.produced << "\n"; 
-    std::cout << "   push fail spins:   " << ctrs.push_fail_spins << "\n";
-    std::cout << "   pop fail spins:    " << ctrs.pop_fail_spins << "\n";
-    std::cout << "   seq mismatches:    " << ctrs.seq_mismatch << "\n";
+        bus.outliers().dump(std::cout, 10); 
+        std::cout << "\n"; 
+
+        std::cout << "Counters:\n";
+        std::cout << "   produced:          " << ctrs.produced << "\n"; 
+        std::cout << "   push fail spins:   " << ctrs.push_fail_spins << "\n";
+        std::cout << "   pop fail spins:    " << ctrs.pop_fail_spins << "\n";
+        std::cout << "   seq mismatches:    " << ctrs.seq_mismatch << "\n";
+        std::cout << "   heartbeats:        " << ctrs.heartbeats << "\n";
+        std::cout << "   stale events:      " << ctrs.stale_events << "\n";
+        std::cout << "   round trips:       " << ctrs.round_trips << "\n\n";
+    }
+
+    if (!config.trace_file.empty()) {
+        std::ofstream trace_out(config.trace_file); 
+        topo.write_trace(trace_out); 
+        std::cout << "Trace written to " << config.trace_file << (SPSC_TRACING ? "\n" : " (empty: built without SPSC_TRACING)\n"); 
+    }
 
     return 0; 
 }
\ No newline at end of file
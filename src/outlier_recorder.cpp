@@ -0,0 +1,169 @@
+#include "outlier_recorder.h"
+
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+
+namespace spsc {
+
+namespace {
+
+// Min-heap on latency: front() is the fastest of the kept outliers
+bool slower(const OutlierRecord& a, const OutlierRecord& b) noexcept {
+    return a.latency_ns > b.latency_ns;
+}
+
+const char* type_name(EventType t) noexcept {
+    switch (t) {
+        case EventType::Trade: return "Trade";
+        case EventType::Quote: return "Quote";
+        case EventType::Heartbeat: return "Heartbeat";
+    }
+    return "?";
+}
+
+}//namespace
+
+OutlierRecorder::OutlierRecorder(std::size_t top_k, std::uint64_t threshold_ns, std::size_t threshold_capacity)
+    : top_k_(top_k),
+      threshold_ns_(threshold_ns),
+      threshold_capacity_(threshold_ns == 0 ? 0 : std::max<std::size_t>(threshold_capacity, 1)),
+      recent_(std::make_unique<OutlierRecord[]>(threshold_capacity_)) {
+
+    heap_.reserve(top_k_);
+    snap_top_.reserve(top_k_);
+    snap_recent_.reserve(threshold_capacity_);
+}
+
+void OutlierRecorder::reset() noexcept {
+    heap_.clear();
+    floor_ns_ = 0;
+    recent_idx_ = 0;
+    recent_count_ = 0;
+    threshold_hits_ = 0;
+}
+
+void OutlierRecorder::record(const Event& e, std::uint64_t dequeue_ns, std::size_t ring_depth) noexcept {
+    OutlierRecord r{};
+    r.latency_ns = dequeue_ns - e.enqueue_ns;
+    r.seq = e.seq;
+    r.enqueue_ns = e.enqueue_ns;
+    r.dequeue_ns = dequeue_ns;
+    r.instrument_id = e.instrument_id;
+    r.ring_depth = static_cast<std::uint32_t>(ring_depth);
+    r.type = e.type;
+
+    if (threshold_ns_ != 0 && r.latency_ns >= threshold_ns_) {
+        recent_[recent_idx_] = r;
+        recent_idx_ = (recent_idx_ + 1 == threshold_capacity_) ? 0 : recent_idx_ + 1;
+        if (recent_count_ < threshold_capacity_) ++recent_count_;
+        ++threshold_hits_;
+    }
+
+    if (top_k_ != 0 && r.latency_ns > floor_ns_) {
+        insert_top_(r);
+    }
+}
+
+void OutlierRecorder::insert_top_(const OutlierRecord& r) noexcept {
+    // push_back stays within the reserved capacity: no allocation
+    if (heap_.size() < top_k_) {
+        heap_.push_back(r);
+        std::push_heap(heap_.begin(), heap_.end(), slower);
+    }
+    else {
+        std::pop_heap(heap_.begin(), heap_.end(), slower);
+        heap_.back() = r;
+        std::push_heap(heap_.begin(), heap_.end(), slower);
+    }
+
+    if (heap_.size() == top_k_) {
+        floor_ns_ = heap_.front().latency_ns;
+    }
+}
+
+void OutlierRecorder::request_snapshot() noexcept {
+    std::uint32_t expected = kSnapIdle;
+    snap_state_.compare_exchange_strong(expected, kSnapRequested, std::memory_order_acq_rel);
+}
+
+void OutlierRecorder::publish_snapshot_() noexcept {
+    // Both vectors have their full capacity reserved: assign() does not allocate
+    snap_top_.assign(heap_.begin(), heap_.end());
+
+    snap_recent_.clear();
+    const std::size_t first = (recent_count_ < threshold_capacity_) ? 0 : recent_idx_;
+    for (std::size_t i = 0; i < recent_count_; ++i) {
+        snap_recent_.push_back(recent_[(first + i) % threshold_capacity_]);
+    }
+
+    snap_state_.store(kSnapReady, std::memory_order_release);
+}
+
+bool OutlierRecorder::take_snapshot(std::vector<OutlierRecord>& top, std::vector<OutlierRecord>& over_threshold) {
+    // Claim it first: back to Idle only after the copy, so no request (and no publish) can
+    // rewrite the snapshot under this reader
+    std::uint32_t expected = kSnapReady;
+    if (!snap_state_.compare_exchange_strong(expected, kSnapTaking, std::memory_order_acquire,
+                                             std::memory_order_relaxed)) {
+        return false;
+    }
+
+    top = snap_top_;
+    std::sort(top.begin(), top.end(), slower);
+    over_threshold = snap_recent_;
+
+    snap_state_.store(kSnapIdle, std::memory_order_release);
+    return true;
+}
+
+std::vector<OutlierRecord> OutlierRecorder::top() const {
+    std::vector<OutlierRecord> out(heap_.begin(), heap_.end());
+    std::sort(out.begin(), out.end(), slower);
+    return out;
+}
+
+std::vector<OutlierRecord> OutlierRecorder::over_threshold() const {
+    std::vector<OutlierRecord> out;
+    out.reserve(recent_count_);
+
+    const std::size_t first = (recent_count_ < threshold_capacity_) ? 0 : recent_idx_;
+    for (std::size_t i = 0; i < recent_count_; ++i) {
+        out.push_back(recent_[(first + i) % threshold_capacity_]);
+    }
+    return out;
+}
+
+void OutlierRecorder::dump(std::ostream& out, std::size_t max_rows) const {
+    const auto rows = top();
+    const std::size_t n = std::min(rows.size(), max_rows);
+
+    out << "Slowest events (" << n << " of " << rows.size() << " kept";
+    if (threshold_ns_ != 0) {
+        out << ", " << threshold_hits_ << " >= " << threshold_ns_ << "ns";
+    }
+    out << "):\n";
+
+    out << "   " << std::setw(12) << "latency_ns"
+        << std::setw(12) << "seq"
+        << std::setw(12) << "instrument"
+        << std::setw(11) << "type"
+        << std::setw(12) << "ring_depth"
+        << std::setw(22) << "enqueue_ns"
+        << std::setw(22) << "dequeue_ns" << "\n";
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto& r = rows[i];
+        out << "   " << std::setw(12) << r.latency_ns
+            << std::setw(12) << r.seq
+            << std::setw(12) << r.instrument_id
+            << std::setw(11) << type_name(r.type)
+            << std::setw(12) << r.ring_depth
+            << std::setw(22) << r.enqueue_ns
+            << std::setw(22) << r.dequeue_ns << "\n";
+    }
+}
+
+}//namespace spsc
@@ -0,0 +1,241 @@
+#include "timer_wheel.h"
+
+
+#include <algorithm>
+#include <bit>
+
+
+namespace spsc {
+
+TimerWheel::TimerWheel(std::size_t max_timers, std::uint64_t start_ns, unsigned tick_shift)
+    : capacity_(max_timers),
+      tick_shift_(tick_shift),
+      nodes_(std::make_unique<Node[]>(max_timers)) {
+
+    reset(start_ns);
+}
+
+void TimerWheel::reset(std::uint64_t start_ns) noexcept {
+    for (auto& level : heads_) {
+        level.fill(kNil);
+    }
+    for (auto& level : occupied_) {
+        level.fill(0);
+    }
+
+    // Free list in index order; bump generations of live timers so old handles can't cancel new ones
+    free_head_ = kNil;
+    for (std::size_t i = capacity_; i-- > 0;) {
+        Node& n = nodes_[i];
+        if (n.active) {
+            n.active = false;
+            if (++n.gen == 0) n.gen = 1;
+        }
+        n.next = free_head_;
+        free_head_ = static_cast<std::uint32_t>(i);
+    }
+
+    active_ = 0;
+    tick_ = start_ns >> tick_shift_;
+    now_ns_ = start_ns;
+}
+
+TimerWheel::TimerId TimerWheel::schedule_at(std::uint64_t deadline_ns, Callback fn, void* ctx, std::uint64_t arg) noexcept {
+    if (free_head_ == kNil) {
+        return kInvalidTimer;
+    }
+
+    const std::uint32_t idx = free_head_;
+    Node& n = nodes_[idx];
+    free_head_ = n.next;
+
+    // Round up: never fire before the deadline. Already-due timers fire on the next tick.
+    const std::uint64_t tick_ns = std::uint64_t{1} << tick_shift_;
+    std::uint64_t expiry = (deadline_ns + tick_ns - 1) >> tick_shift_;
+    if (expiry <= tick_) {
+        expiry = tick_ + 1;
+    }
+
+    n.expiry_tick = expiry;
+    n.fn = fn;
+    n.ctx = ctx;
+    n.arg = arg;
+    n.active = true;
+
+    insert_(idx);
+    ++active_;
+
+    return (static_cast<TimerId>(n.gen) << 32) | idx;
+}
+
+bool TimerWheel::cancel(TimerId id) noexcept {
+    const auto idx = static_cast<std::uint32_t>(id & 0xFFFF'FFFFu);
+    const auto gen = static_cast<std::uint32_t>(id >> 32);
+
+    if (id == kInvalidTimer || idx >= capacity_) {
+        return false;
+    }
+
+    Node& n = nodes_[idx];
+    if (!n.active || n.gen != gen) {
+        return false;
+    }
+
+    unlink_(idx);
+    release_(idx);
+    return true;
+}
+
+void TimerWheel::insert_(std::uint32_t idx) noexcept {
+    Node& n = nodes_[idx];
+
+    // Level by distance: anything under 256^(l+1) ticks away sits at level l, in the slot of its
+    // expiry digit, and cascades down when that slot's window opens. Beyond the top level's range,
+    // park at the furthest reachable slot; the cascade re-places it against the real expiry.
+    constexpr std::uint64_t kMaxDelta = (std::uint64_t{1} << (kLevels * kSlotBits)) - 1;
+    const std::uint64_t delta = std::min(n.expiry_tick - tick_, kMaxDelta);
+    const std::uint64_t at = tick_ + delta;
+
+    const unsigned level = delta == 0 ? 0 : static_cast<unsigned>(std::bit_width(delta) - 1) / kSlotBits;
+    const std::size_t slot = static_cast<std::size_t>(at >> (level * kSlotBits)) & (kSlots - 1);
+
+    n.level = static_cast<std::uint8_t>(level);
+    n.slot = static_cast<std::uint16_t>(slot);
+    n.prev = kNil;
+    n.next = heads_[level][slot];
+
+    if (n.next != kNil) {
+        nodes_[n.next].prev = idx;
+    }
+    heads_[level][slot] = idx;
+    occupied_[level][slot / 64] |= std::uint64_t{1} << (slot % 64);
+}
+
+void TimerWheel::unlink_(std::uint32_t idx) noexcept {
+    Node& n = nodes_[idx];
+
+    if (n.prev != kNil) nodes_[n.prev].next = n.next;
+    else heads_[n.level][n.slot] = n.next;
+
+    if (n.next != kNil) nodes_[n.next].prev = n.prev;
+
+    if (heads_[n.level][n.slot] == kNil) {
+        occupied_[n.level][n.slot / 64] &= ~(std::uint64_t{1} << (n.slot % 64));
+    }
+}
+
+void TimerWheel::release_(std::uint32_t idx) noexcept {
+    Node& n = nodes_[idx];
+    n.active = false;
+    ++n.gen;
+    if (n.gen == 0) n.gen = 1;          // keep ids != kInvalidTimer after wrap
+
+    n.next = free_head_;
+    free_head_ = idx;
+    --active_;
+}
+
+void TimerWheel::cascade_(unsigned level, std::size_t slot) noexcept {
+    std::uint32_t idx = heads_[level][slot];
+    heads_[level][slot] = kNil;
+    occupied_[level][slot / 64] &= ~(std::uint64_t{1} << (slot % 64));
+
+    while (idx != kNil) {
+        const std::uint32_t next = nodes_[idx].next;
+        insert_(idx);                   // lands on a lower level (or level 0 slot of this tick)
+        idx = next;
+    }
+}
+
+std::size_t TimerWheel::expire_(std::size_t slot, std::uint64_t now_ns) noexcept {
+    // Pop one node at a time: a callback may cancel a sibling still queued in this slot, so the
+    // rest of the list must stay linked. Timers scheduled from a callback land at least one tick
+    // ahead, never in this slot, so the loop ends.
+    std::size_t fired = 0;
+    for (std::uint32_t idx = heads_[0][slot]; idx != kNil; idx = heads_[0][slot]) {
+        Node& n = nodes_[idx];
+
+        // Release before the callback so it can reschedule (possibly reusing this node)
+        const Callback fn = n.fn;
+        void* const ctx = n.ctx;
+        const std::uint64_t arg = n.arg;
+        unlink_(idx);
+        release_(idx);
+
+        fn(ctx, arg, now_ns);
+        ++fired;
+    }
+    return fired;
+}
+
+std::size_t TimerWheel::next_occupied_(unsigned level, std::size_t from) const noexcept {
+    for (std::size_t w = from / 64; w < kWordsPerLevel; ++w) {
+        std::uint64_t bits = occupied_[level][w];
+        if (w == from / 64) {
+            bits &= ~std::uint64_t{0} << (from % 64);
+        }
+        if (bits != 0) {
+            return w * 64 + static_cast<std::size_t>(std::countr_zero(bits));
+        }
+    }
+    return kSlots;
+}
+
+std::uint64_t TimerWheel::next_work_tick_() const noexcept {
+    std::uint64_t best = ~std::uint64_t{0};
+
+    for (unsigned level = 0; level < kLevels; ++level) {
+        const unsigned shift = level * kSlotBits;
+        const std::size_t digit = static_cast<std::size_t>(tick_ >> shift) & (kSlots - 1);
+        const std::uint64_t window = (tick_ >> (shift + kSlotBits)) << (shift + kSlotBits);
+
+        // A slot at or behind the current digit is next reached in the following window
+        std::size_t slot = (digit + 1 < kSlots) ? next_occupied_(level, digit + 1) : kSlots;
+        std::uint64_t at = window;
+        if (slot == kSlots) {
+            slot = next_occupied_(level, 0);
+            at += std::uint64_t{1} << (shift + kSlotBits);
+        }
+        if (slot != kSlots) {
+            best = std::min(best, at + (static_cast<std::uint64_t>(slot) << shift));
+        }
+    }
+    return best;
+}
+
+std::size_t TimerWheel::advance(std::uint64_t now_ns) noexcept {
+    if (now_ns <= now_ns_) {
+        return 0;
+    }
+    now_ns_ = now_ns;
+
+    const std::uint64_t target = now_ns >> tick_shift_;
+    std::size_t fired = 0;
+
+    while (tick_ < target) {
+        if (active_ == 0) {
+            tick_ = target;
+            break;
+        }
+
+        // Jump straight to the next tick with work (an expiry or a cascade), or the target
+        tick_ = std::min(next_work_tick_(), target);
+
+        // Rollover: cascade from the highest level whose lower digits are all zero, downward
+        if ((tick_ & (kSlots - 1)) == 0) {
+            unsigned top = 1;
+            while (top + 1 < kLevels && ((tick_ >> (top * kSlotBits)) & (kSlots - 1)) == 0) {
+                ++top;
+            }
+            for (unsigned l = top; l >= 1; --l) {
+                cascade_(l, static_cast<std::size_t>(tick_ >> (l * kSlotBits)) & (kSlots - 1));
+            }
+        }
+
+        fired += expire_(static_cast<std::size_t>(tick_ & (kSlots - 1)), now_ns);
+    }
+
+    return fired;
+}
+
+}//namespace spsc
@@ -0,0 +1,260 @@
+#include "topology.h"
+
+
+#include <charconv>
+#include <fstream>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "latency_tracker.h"
+
+
+namespace spsc {
+
+namespace {
+
+std::string_view trim(std::string_view s) noexcept {
+    const auto first = s.find_first_not_of(" \t\r");
+    if (first == std::string_view::npos) return {};
+    const auto last = s.find_last_not_of(" \t\r");
+    return s.substr(first, last - first + 1);
+}
+
+[[noreturn]] void fail(std::size_t line_no, const std::string& what) {
+    throw std::runtime_error("topology config line " + std::to_string(line_no) + ": " + what);
+}
+
+template <typename Int>
+Int parse_int(std::string_view value, std::size_t line_no) {
+    Int out{};
+    const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), out);
+    if (ec != std::errc{} || ptr != value.data() + value.size()) {
+        fail(line_no, "expected an integer, got '" + std::string(value) + "'");
+    }
+    return out;
+}
+
+// Sizes are checked here so a bad value fails with its line number, not at construction or mid-run
+constexpr std::size_t kMaxCapacity = std::size_t{1} << 30;
+
+std::size_t parse_size(std::string_view key, std::string_view value, std::size_t line_no,
+                       std::size_t lo = 1, std::size_t hi = kMaxCapacity) {
+    const auto v = parse_int<std::size_t>(value, line_no);
+    if (v < lo || v > hi) {
+        fail(line_no, std::string(key) + " must be in [" + std::to_string(lo) + ", " + std::to_string(hi)
+                      + "], got " + std::to_string(v));
+    }
+    return v;
+}
+
+WaitStrategy parse_wait(std::string_view value, std::size_t line_no) {
+    if (value == "spin") return WaitStrategy::Spin;
+    if (value == "spin_yield") return WaitStrategy::SpinYield;
+    if (value == "yield") return WaitStrategy::Yield;
+    fail(line_no, "unknown wait strategy '" + std::string(value) + "'");
+}
+
+MemoryPolicy parse_memory(std::string_view value, std::size_t line_no) {
+    if (value == "lazy") return MemoryPolicy::Lazy;
+    if (value == "prefault") return MemoryPolicy::Prefault;
+    fail(line_no, "unknown memory policy '" + std::string(value) + "'");
+}
+
+bool parse_bool(std::string_view value, std::size_t line_no) {
+    if (value == "true" || value == "on" || value == "1") return true;
+    if (value == "false" || value == "off" || value == "0") return false;
+    fail(line_no, "expected true or false, got '" + std::string(value) + "'");
+}
+
+}//namespace
+
+
+TopologyConfig TopologyConfig::parse(std::istream& in) {
+    enum class Section { None, Runtime, Bus };
+
+    TopologyConfig cfg{};
+    Section section = Section::None;
+
+    std::string raw;
+    std::size_t line_no = 0;
+    std::size_t udp_line = 0;               // first udp_listen key, checked against events at the end
+    std::vector<std::size_t> in_flight_line;    // per bus (0 = not set), checked against ring_capacity
+
+    while (std::getline(in, raw)) {
+        ++line_no;
+
+        std::string_view line = raw;
+        if (const auto hash = line.find('#'); hash != std::string_view::npos) {
+            line = line.substr(0, hash);
+        }
+        line = trim(line);
+        if (line.empty()) continue;
+
+        if (line.front() == '[') {
+            if (line.back() != ']') fail(line_no, "unterminated section header");
+            const std::string_view header = trim(line.substr(1, line.size() - 2));
+
+            if (header == "runtime") {
+                section = Section::Runtime;
+            }
+            else if (header.substr(0, 4) == "bus " || header == "bus") {
+                const std::string_view name = trim(header.substr(3));
+                if (name.empty()) fail(line_no, "bus section needs a name: [bus <name>]");
+
+                for (const auto& b : cfg.buses) {
+                    if (b.name == name) fail(line_no, "duplicate bus '" + std::string(name) + "'");
+                }
+
+                cfg.buses.push_back(Bus{std::string(name), EventBus::Options{}});
+                in_flight_line.push_back(0);
+                section = Section::Bus;
+            }
+            else {
+                fail(line_no, "unknown section '" + std::string(header) + "'");
+            }
+            continue;
+        }
+
+        const auto eq = line.find('=');
+        if (eq == std::string_view::npos) fail(line_no, "expected key = value");
+
+        const std::string_view key = trim(line.substr(0, eq));
+        const std::string_view value = trim(line.substr(eq + 1));
+
+        if (section == Section::Runtime) {
+            if (key == "warmup_events") cfg.warmup_events = parse_int<std::uint64_t>(value, line_no);
+            else if (key == "events") cfg.events = parse_int<std::uint64_t>(value, line_no);
+            else if (key == "trace_file") cfg.trace_file = std::string(value);
+            else fail(line_no, "unknown runtime key '" + std::string(key) + "'");
+        }
+        else if (section == Section::Bus) {
+            EventBus::Options& o = cfg.buses.back().options;
+
+            if (key == "ring_capacity") o.ring_capacity = parse_size(key, value, line_no);
+            else if (key == "max_latency_samples") o.max_latency_samples = parse_size(key, value, line_no);
+            else if (key == "producer_core") o.producer_core = parse_int<int>(value, line_no);
+            else if (key == "consumer_core") o.consumer_core = parse_int<int>(value, line_no);
+            else if (key == "wait") o.wait = parse_wait(value, line_no);
+            else if (key == "memory") o.memory = parse_memory(value, line_no);
+            else if (key == "trace_sample_every") o.trace_sample_every = parse_int<std::uint64_t>(value, line_no);
+            else if (key == "trace_capacity") o.trace_capacity = parse_size(key, value, line_no);
+            else if (key == "outlier_top_k") o.outlier_top_k = parse_int<std::size_t>(value, line_no);
+            else if (key == "outlier_threshold_ns") o.outlier_threshold_ns = parse_int<std::uint64_t>(value, line_no);
+            else if (key == "outlier_threshold_capacity") o.outlier_threshold_capacity = parse_int<std::size_t>(value, line_no);
+            else if (key == "heartbeat_every_ns") o.heartbeat_every_ns = parse_int<std::uint64_t>(value, line_no);
+            else if (key == "stale_after_ns") o.stale_after_ns = parse_int<std::uint64_t>(value, line_no);
+            else if (key == "max_instruments") o.max_instruments = parse_int<std::size_t>(value, line_no);
+            else if (key == "round_trip") o.round_trip = parse_bool(value, line_no);
+            else if (key == "in_flight") {
+                o.in_flight = parse_size(key, value, line_no);
+                in_flight_line.back() = line_no;
+            }
+            else if (key == "think_ns") o.think_ns = parse_int<std::uint64_t>(value, line_no);
+#if SPSC_UDP_INGEST
+            else if (key == "udp_listen") {
+                o.udp_listen = std::string(value);
+                if (udp_line == 0) udp_line = line_no;
+            }
+            else if (key == "udp_batch") o.udp_batch = parse_int<std::size_t>(value, line_no);
+#else
+            else if (key == "udp_listen" || key == "udp_batch") fail(line_no, "built without SPSC_UDP_INGEST");
+#endif
+            else fail(line_no, "unknown bus key '" + std::string(key) + "'");
+        }
+        else {
+            fail(line_no, "key outside of a section");
+        }
+    }
+
+    if (cfg.buses.empty()) {
+        throw std::runtime_error("topology config: no [bus <name>] sections");
+    }
+
+    // ring_capacity may come after in_flight in the section: compare once the whole file is read
+    for (std::size_t i = 0; i < cfg.buses.size(); ++i) {
+        const EventBus::Options& o = cfg.buses[i].options;
+        if (in_flight_line[i] != 0 && o.in_flight > o.ring_capacity) {
+            fail(in_flight_line[i], "in_flight (" + std::to_string(o.in_flight) + ") exceeds ring_capacity ("
+                                    + std::to_string(o.ring_capacity) + ")");
+        }
+    }
+
+    // Synthetic producers could run until stop(); a UDP feed has no end, and nothing calls stop()
+    if (udp_line != 0 && cfg.events == 0) {
+        fail(udp_line, "udp_listen needs a non-zero [runtime] events target to end the run");
+    }
+
+    return cfg;
+}
+
+TopologyConfig TopologyConfig::load(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        throw std::runtime_error("topology config: cannot open '" + path + "'");
+    }
+    return parse(in);
+}
+
+
+Topology::Topology(TopologyConfig config)
+    : config_(std::move(config)) {
+
+    const std::uint64_t t0 = LatencyTracker::now_ns();
+
+    buses_.reserve(config_.buses.size());
+    for (const auto& b : config_.buses) {
+        buses_.push_back(std::make_unique<EventBus>(b.options));
+    }
+
+    const std::uint64_t t1 = LatencyTracker::now_ns();
+
+    for (auto& bus : buses_) {
+        bus->launch();
+    }
+
+    const std::uint64_t t2 = LatencyTracker::now_ns();
+
+    // Warm code paths, branch predictors and caches; stats are reset by the next start().
+    // UDP-fed buses are skipped: their events only arrive once the feed is up.
+    if (config_.warmup_events > 0) {
+        for (auto& bus : buses_) {
+#if SPSC_UDP_INGEST
+            if (!bus->options().udp_listen.empty()) continue;
+#endif
+            bus->start(config_.warmup_events);
+        }
+        join();
+    }
+
+    const std::uint64_t t3 = LatencyTracker::now_ns();
+
+    ready_.build_ns = t1 - t0;
+    ready_.launch_ns = t2 - t1;
+    ready_.warmup_ns = t3 - t2;
+    ready_.total_ns = t3 - t0;
+}
+
+void Topology::start(std::uint64_t target_events) {
+    for (auto& bus : buses_) {
+        bus->start(target_events);
+    }
+}
+
+void Topology::join() {
+    for (auto& bus : buses_) {
+        bus->join();
+    }
+}
+
+void Topology::write_trace(std::ostream& out) const {
+    ChromeTraceWriter writer{out};
+    for (std::size_t i = 0; i < buses_.size(); ++i) {
+        buses_[i]->write_trace(writer, static_cast<std::uint32_t>(i + 1), config_.buses[i].name.c_str());
+    }
+}
+
+}//namespace spsc
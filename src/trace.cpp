@@ -0,0 +1,111 @@
+#include "trace.h"
+
+
+#include <cstdio>
+#include <iomanip>
+#include <ostream>
+
+
+namespace spsc {
+
+const char* hop_name(Hop hop) noexcept {
+    switch (hop) {
+        case Hop::Produce: return "produce";
+        case Hop::Ring: return "ring";
+        case Hop::Handle: return "handle";
+    }
+    return "unknown";
+}
+
+TraceBuffer::TraceBuffer(std::size_t capacity)
+    : capacity_(capacity == 0 ? 1 : capacity),
+      spans_(std::make_unique<TraceSpan[]>(capacity_)) {}
+
+
+namespace {
+
+// One track (Chrome "tid") per hop, in pipeline order
+constexpr std::uint32_t track_of(Hop hop) noexcept {
+    return static_cast<std::uint32_t>(hop) + 1;
+}
+
+constexpr const char* kTrackNames[kHopCount] = {"producer", "ring transit", "consumer"};
+
+// JSON string body: names come from config files and may hold quotes, backslashes or controls
+void write_escaped(std::ostream& out, const char* s) {
+    for (; *s != '\0'; ++s) {
+        const unsigned char c = static_cast<unsigned char>(*s);
+        switch (c) {
+            case '"': out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\r': out << "\\r"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    out << buf;
+                }
+                else {
+                    out << *s;
+                }
+        }
+    }
+}
+
+}//namespace
+
+ChromeTraceWriter::ChromeTraceWriter(std::ostream& out)
+    : out_(out) {
+    out_ << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+}
+
+ChromeTraceWriter::~ChromeTraceWriter() {
+    out_ << "\n]}\n";
+}
+
+void ChromeTraceWriter::begin_event_() {
+    out_ << (first_ ? "\n" : ",\n");
+    first_ = false;
+}
+
+void ChromeTraceWriter::add_process(std::uint32_t pid, const char* name) {
+    begin_event_();
+    out_ << "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":" << pid
+         << ",\"tid\":0,\"args\":{\"name\":\"";
+    write_escaped(out_, name);
+    out_ << "\"}}";
+
+    for (std::size_t h = 0; h < kHopCount; ++h) {
+        begin_event_();
+        out_ << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" << pid
+             << ",\"tid\":" << track_of(static_cast<Hop>(h))
+             << ",\"args\":{\"name\":\"" << kTrackNames[h] << "\"}}";
+    }
+}
+
+void ChromeTraceWriter::add(const TraceBuffer& buffer, std::uint32_t pid) {
+    const auto flags = out_.flags();
+    const auto precision = out_.precision();
+    out_ << std::fixed << std::setprecision(3);
+
+    // Complete ("X") events; timestamps are microseconds
+    for (std::size_t i = 0; i < buffer.size(); ++i) {
+        const TraceSpan& s = buffer[i];
+        const std::uint64_t dur = s.end_ns >= s.begin_ns ? s.end_ns - s.begin_ns : 0;
+
+        begin_event_();
+        out_ << "{\"ph\":\"X\",\"name\":\"" << hop_name(s.hop)
+             << "\",\"pid\":" << pid
+             << ",\"tid\":" << track_of(s.hop)
+             << ",\"ts\":" << static_cast<double>(s.begin_ns) / 1000.0
+             << ",\"dur\":" << static_cast<double>(dur) / 1000.0
+             << ",\"args\":{\"seq\":" << s.seq << "}}";
+    }
+
+    out_.flags(flags);
+    out_.precision(precision);
+}
+
+}//namespace spsc
@@ -0,0 +1,267 @@
+#include "udp_ingest.h"
+
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <system_error>
+#include <thread>
+
+#include "latency_tracker.h"
+
+
+namespace spsc {
+
+namespace {
+
+[[noreturn]] void throw_errno(const std::string& what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+sockaddr_in parse_endpoint(const std::string& endpoint) {
+    const auto colon = endpoint.rfind(':');
+    if (colon == std::string::npos) {
+        throw std::system_error(EINVAL, std::generic_category(), "udp endpoint '" + endpoint + "': expected host:port");
+    }
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+
+    const std::string host = endpoint.substr(0, colon);
+    if (inet_pton(AF_INET, host.empty() ? "0.0.0.0" : host.c_str(), &addr.sin_addr) != 1) {
+        throw std::system_error(EINVAL, std::generic_category(), "udp endpoint '" + endpoint + "': bad IPv4 address");
+    }
+
+    char* end = nullptr;
+    const unsigned long port = std::strtoul(endpoint.c_str() + colon + 1, &end, 10);
+    if (end == endpoint.c_str() + colon + 1 || *end != '\0' || port > 65535) {
+        throw std::system_error(EINVAL, std::generic_category(), "udp endpoint '" + endpoint + "': bad port");
+    }
+    addr.sin_port = htons(static_cast<std::uint16_t>(port));
+    return addr;
+}
+
+std::uint64_t clock_ns(clockid_t id) noexcept {
+    timespec ts{};
+    clock_gettime(id, &ts);
+    return static_cast<std::uint64_t>(ts.tv_sec) * 1'000'000'000ull + static_cast<std::uint64_t>(ts.tv_nsec);
+}
+
+}//namespace
+
+
+UdpIngest::UdpIngest(const std::string& endpoint, std::size_t batch, int rcvbuf_bytes)
+    : batch_(batch == 0 ? 1 : batch),
+      data_(std::make_unique_for_overwrite<std::byte[]>(batch_ * wire::kMaxDatagram)),
+      control_(std::make_unique_for_overwrite<std::byte[]>(batch_ * kControlLen)),
+      iov_(std::make_unique<iovec[]>(batch_)),
+      msgs_(std::make_unique<mmsghdr[]>(batch_)),
+      packets_(std::make_unique<Packet[]>(batch_)) {
+
+    sockaddr_in addr = parse_endpoint(endpoint);
+
+    fd_ = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) throw_errno("udp ingest: socket");
+
+    const int one = 1;
+    ::setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    ::setsockopt(fd_, SOL_SOCKET, SO_RCVBUF, &rcvbuf_bytes, sizeof(rcvbuf_bytes));      // capped by rmem_max
+    ::setsockopt(fd_, SOL_SOCKET, SO_TIMESTAMPNS, &one, sizeof(one));                   // best effort
+
+    const bool multicast = IN_MULTICAST(ntohl(addr.sin_addr.s_addr));
+    const in_addr group = addr.sin_addr;
+    if (multicast) {
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    }
+
+    if (::bind(fd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+        const int err = errno;
+        ::close(fd_);
+        throw std::system_error(err, std::generic_category(), "udp ingest: bind " + endpoint);
+    }
+
+    if (multicast) {
+        ip_mreq mreq{};
+        mreq.imr_multiaddr = group;
+        mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+        if (::setsockopt(fd_, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) != 0) {
+            const int err = errno;
+            ::close(fd_);
+            throw std::system_error(err, std::generic_category(), "udp ingest: join " + endpoint);
+        }
+    }
+
+    sockaddr_in bound{};
+    socklen_t bound_len = sizeof(bound);
+    ::getsockname(fd_, reinterpret_cast<sockaddr*>(&bound), &bound_len);
+    port_ = ntohs(bound.sin_port);
+
+    for (std::size_t i = 0; i < batch_; ++i) {
+        iov_[i].iov_base = data_.get() + i * wire::kMaxDatagram;
+        iov_[i].iov_len = wire::kMaxDatagram;
+    }
+}
+
+UdpIngest::~UdpIngest() {
+    if (fd_ >= 0) ::close(fd_);
+}
+
+void UdpIngest::prefault() noexcept {
+    std::memset(data_.get(), 0, batch_ * wire::kMaxDatagram);
+    std::memset(control_.get(), 0, batch_ * kControlLen);
+}
+
+std::size_t UdpIngest::receive() noexcept {
+    // recvmmsg overwrites msg_len / msg_controllen / msg_flags: re-arm every call
+    for (std::size_t i = 0; i < batch_; ++i) {
+        msghdr& h = msgs_[i].msg_hdr;
+        h.msg_name = nullptr;
+        h.msg_namelen = 0;
+        h.msg_iov = &iov_[i];
+        h.msg_iovlen = 1;
+        h.msg_control = control_.get() + i * kControlLen;
+        h.msg_controllen = kControlLen;
+        h.msg_flags = 0;
+        msgs_[i].msg_len = 0;
+    }
+
+    const int n = ::recvmmsg(fd_, msgs_.get(), static_cast<unsigned>(batch_), MSG_DONTWAIT, nullptr);
+    if (n <= 0) {
+        return 0;
+    }
+
+    // Kernel stamps are CLOCK_REALTIME; map them onto the steady clock the consumer reads
+    const std::uint64_t steady = LatencyTracker::now_ns();
+    const std::uint64_t real = clock_ns(CLOCK_REALTIME);
+
+    for (int i = 0; i < n; ++i) {
+        msghdr& h = msgs_[i].msg_hdr;
+        Packet& p = packets_[i];
+
+        p.data = static_cast<const std::byte*>(iov_[i].iov_base);
+        p.len = (h.msg_flags & MSG_TRUNC) ? 0 : msgs_[i].msg_len;   // truncated: fails decode
+        p.rx_ns = steady;
+
+        for (cmsghdr* c = CMSG_FIRSTHDR(&h); c != nullptr; c = CMSG_NXTHDR(&h, c)) {
+            if (c->cmsg_level == SOL_SOCKET && c->cmsg_type == SCM_TIMESTAMPNS) {
+                timespec ts{};
+                std::memcpy(&ts, CMSG_DATA(c), sizeof(ts));
+                const std::uint64_t rx_real = static_cast<std::uint64_t>(ts.tv_sec) * 1'000'000'000ull
+                                            + static_cast<std::uint64_t>(ts.tv_nsec);
+
+                // Clamp: a stamp can't be later than "now" (clock steps would otherwise go negative)
+                const std::uint64_t age = real > rx_real ? real - rx_real : 0;
+                p.rx_ns = steady > age ? steady - age : 0;
+                kernel_ts_ = true;
+            }
+        }
+    }
+
+    return static_cast<std::size_t>(n);
+}
+
+
+UdpSender::UdpSender(const std::string& endpoint, std::size_t batch)
+    : batch_(batch == 0 ? 1 : batch),
+      data_(std::make_unique<std::byte[]>(batch_ * wire::kMaxDatagram)),
+      iov_(std::make_unique<iovec[]>(batch_)),
+      msgs_(std::make_unique<mmsghdr[]>(batch_)) {
+
+    const sockaddr_in addr = parse_endpoint(endpoint);
+
+    fd_ = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) throw_errno("udp sender: socket");
+
+    // connect() fixes the destination: sendmmsg needs no per-message address
+    if (::connect(fd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+        const int err = errno;
+        ::close(fd_);
+        throw std::system_error(err, std::generic_category(), "udp sender: connect " + endpoint);
+    }
+
+    for (std::size_t i = 0; i < batch_; ++i) {
+        iov_[i].iov_base = data_.get() + i * wire::kMaxDatagram;
+        msgs_[i].msg_hdr.msg_iov = &iov_[i];
+        msgs_[i].msg_hdr.msg_iovlen = 1;
+    }
+}
+
+UdpSender::~UdpSender() {
+    if (fd_ >= 0) ::close(fd_);
+}
+
+std::uint64_t UdpSender::send(std::uint64_t packets, std::size_t events_per_packet, std::uint64_t gap_ns) {
+    if (events_per_packet > wire::kMaxEventsPerPacket) events_per_packet = wire::kMaxEventsPerPacket;
+
+    Event events[wire::kMaxEventsPerPacket];
+    std::uint64_t sent = 0;
+    std::uint64_t delivered = 0;
+    std::uint64_t next_ns = LatencyTracker::now_ns();
+
+    while (sent < packets) {
+        const std::size_t n = static_cast<std::size_t>(
+            (packets - sent) < batch_ ? (packets - sent) : batch_);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t k = 0; k < events_per_packet; ++k) {
+                const std::uint64_t seq = next_seq_ + k;
+                Event& e = events[k];
+                e.seq = seq;
+                e.instrument_id = static_cast<std::uint32_t>(seq & 0xFFFF);
+                e.qty = 100u + static_cast<std::uint32_t>(seq & 0x3F);
+                e.price_ticks = 100'000 + static_cast<std::int64_t>(seq % 1'000);
+                e.type = (seq % 8 == 0) ? EventType::Trade : EventType::Quote;
+                e.side = (seq & 1) ? Side::Buy : Side::Sell;
+            }
+
+            iov_[i].iov_len = wire::encode_packet(static_cast<std::byte*>(iov_[i].iov_base), wire::kMaxDatagram,
+                                                  next_packet_ + i, LatencyTracker::now_ns(), events, events_per_packet);
+            next_seq_ += events_per_packet;
+        }
+
+        // Pace whole batches: gap_ns per packet on average
+        if (gap_ns != 0) {
+            while (LatencyTracker::now_ns() < next_ns) std::this_thread::yield();
+            next_ns += gap_ns * n;
+        }
+
+        // Full socket buffer, or no listener (ECONNREFUSED from an earlier datagram): back off
+        // 2us doubling to ~1ms; after kMaxSendRetries failures in a row drop the rest of the
+        // batch, which the receiver sees as a packet sequence gap
+        std::size_t off = 0;
+        unsigned retries = 0;
+        while (off < n) {
+            const int rc = ::sendmmsg(fd_, msgs_.get() + off, static_cast<unsigned>(n - off), 0);
+            if (rc >= 0) {
+                off += static_cast<std::size_t>(rc);
+                retries = 0;
+                continue;
+            }
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != ENOBUFS && errno != ECONNREFUSED) {
+                throw_errno("udp sender: sendmmsg");
+            }
+            if (++retries > kMaxSendRetries) {
+                dropped_ += n - off;
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(1u << std::min(retries, 10u)));
+        }
+
+        next_packet_ += n;
+        sent += n;
+        delivered += off;
+    }
+
+    return delivered;
+}
+
+}//namespace spsc
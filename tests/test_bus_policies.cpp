@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "bus_policies.h"
+#include "event_bus.h"
+#include "ring_buffer.h"
+
+
+namespace {
+
+// Minimal custom payload: just the bookkeeping fields plus a value
+struct Tick {
+    std::uint64_t enqueue_ns{0};
+    std::uint64_t seq{0};
+    double value{0.0};
+};
+
+struct Recorder {
+    std::vector<std::uint64_t> seqs;
+    std::uint64_t last_now{0};
+    bool monotonic{true};
+
+    void operator()(const Tick& t, std::uint64_t now_ns) {
+        seqs.push_back(t.seq);
+        monotonic = monotonic && now_ns >= last_now && now_ns >= t.enqueue_ns;
+        last_now = now_ns;
+    }
+};
+
+using TickBus = spsc::BasicEventBus<Tick, SpscRingBuffer<Tick>, spsc::YieldWait, spsc::SteadyClock, Recorder>;
+
+// Policies that must be rejected at compile time
+struct NoSeq { std::uint64_t enqueue_ns{0}; };
+struct NoPrefaultQueue {
+    explicit NoPrefaultQueue(std::size_t) {}
+    bool try_push(Tick&&) { return false; }
+    bool try_pop(Tick&) { return false; }
+    bool empty() const { return true; }
+    std::size_t size() const { return 0; }
+    std::size_t capacity() const { return 0; }
+};
+struct ThrowingWait { void idle(std::uint64_t) const {} };      // not noexcept
+struct WallClock { static std::uint64_t now_ns() noexcept { return 0; } };
+
+}//namespace
+
+
+// Defaults satisfy their concepts; malformed policies don't
+static_assert(spsc::BusPayload<spsc::Event>);
+static_assert(spsc::BusQueue<SpscRingBuffer<spsc::Event>, spsc::Event>);
+static_assert(spsc::WaitPolicy<spsc::RuntimeWait> && spsc::WaitPolicy<spsc::SpinWait>);
+static_assert(spsc::BusClock<spsc::SteadyClock> && spsc::BusClock<WallClock>);
+static_assert(spsc::BusHandler<spsc::NoopHandler, spsc::Event>);
+
+static_assert(!spsc::BusPayload<NoSeq>);
+static_assert(!spsc::BusQueue<NoPrefaultQueue, Tick>);
+static_assert(!spsc::WaitPolicy<ThrowingWait>);
+static_assert(!spsc::BusHandler<Recorder, spsc::Event>);
+
+
+TEST(BusPolicies, CustomPayloadAndHandlerSeeEveryEventInOrder) {
+    TickBus::Options opts;
+    opts.ring_capacity = 64;
+    opts.max_latency_samples = 4096;
+
+    TickBus bus(opts);
+    for (std::uint64_t run = 1; run <= 2; ++run) {
+        bus.handler().seqs.clear();
+        bus.start(run * 1000);
+        bus.join();
+
+        const auto& seqs = bus.handler().seqs;
+        ASSERT_EQ(seqs.size(), run * 1000);
+        for (std::uint64_t i = 0; i < seqs.size(); ++i) ASSERT_EQ(seqs[i], i);
+        EXPECT_TRUE(bus.handler().monotonic);
+
+        const auto c = bus.counters();
+        EXPECT_EQ(c.consumed, run * 1000);
+        EXPECT_EQ(c.seq_mismatch, 0u);
+        EXPECT_EQ(bus.latency_stats().count, run * 1000);
+    }
+}
+
+TEST(BusPolicies, RoundTripWorksForAnyPayload) {
+    TickBus::Options opts;
+    opts.ring_capacity = 64;
+    opts.max_latency_samples = 4096;
+    opts.round_trip = true;
+    opts.in_flight = 4;
+
+    TickBus bus(opts);
+    bus.start(500);
+    bus.join();
+
+    EXPECT_EQ(bus.counters().round_trips, 500u);
+    EXPECT_EQ(bus.rtt_half_stats().count, 500u);
+    EXPECT_EQ(bus.handler().seqs.size(), 500u);
+}
+
+// Market-data options and accessors exist only for Payload = Event
+namespace {
+
+template <typename O>
+concept HasFeedOptions = requires(O o) { o.stale_after_ns; o.outlier_top_k; };
+
+template <typename C>
+concept HasFeedCounters = requires(C c) { c.heartbeats; c.stale_events; };
+
+template <typename B>
+concept HasOutliers = requires(B& b) { b.outliers(); };
+
+}//namespace
+
+static_assert(HasFeedOptions<spsc::EventBus::Options> && HasOutliers<spsc::EventBus>);
+static_assert(!HasFeedOptions<TickBus::Options> && !HasOutliers<TickBus>);
+static_assert(std::same_as<TickBus::Options, spsc::BusOptions>);
+static_assert(HasFeedCounters<spsc::EventBus::Counters> && !HasFeedCounters<TickBus::Counters>);
+static_assert(std::is_empty_v<spsc::detail::EventFeatures<Tick>>);        // no recorder, wheel or socket
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "coro_channel.h"
+
+
+namespace {
+
+spsc::Task collect(spsc::Channel<int>& ch, std::vector<int>& out, int n) {
+    for (int i = 0; i < n; ++i) {
+        out.push_back(co_await ch.next());
+    }
+}
+
+spsc::Task collect_batches(spsc::Channel<int>& ch, std::vector<int>& out, std::size_t n) {
+    int buf[4];
+    while (out.size() < n) {
+        const std::size_t got = co_await ch.next_batch(buf, 4);
+        out.insert(out.end(), buf, buf + got);
+    }
+}
+
+spsc::Task sum_forever(spsc::Channel<std::uint64_t>& ch, std::uint64_t& sum) {
+    for (;;) {
+        sum += co_await ch.next();
+    }
+}
+
+}//namespace
+
+
+TEST(CoroChannel, ReadyValuesDoNotSuspend) {
+    SpscRingBuffer<int> rb(8);
+    spsc::PollScheduler sched;
+    spsc::Channel<int> ch(rb, sched);
+
+    ASSERT_TRUE(rb.try_push(1));
+    ASSERT_TRUE(rb.try_push(2));
+
+    std::vector<int> got;
+    spsc::Task t = collect(ch, got, 2);
+    sched.spawn(t);
+
+    EXPECT_TRUE(t.done());
+    EXPECT_EQ(got, (std::vector<int>{1, 2}));
+    EXPECT_EQ(sched.waiting(), 0u);
+}
+
+TEST(CoroChannel, SuspendsWhenEmptyAndResumesOnData) {
+    SpscRingBuffer<int> rb(8);
+    spsc::PollScheduler sched;
+    spsc::Channel<int> ch(rb, sched);
+
+    std::vector<int> got;
+    spsc::Task t = collect(ch, got, 3);
+    sched.spawn(t);
+
+    EXPECT_FALSE(t.done());
+    EXPECT_EQ(sched.waiting(), 1u);
+    EXPECT_EQ(sched.poll(), 0u);        // still empty: nothing resumed
+
+    ASSERT_TRUE(rb.try_push(7));
+    EXPECT_EQ(sched.poll(), 1u);
+    EXPECT_EQ(got, (std::vector<int>{7}));
+
+    ASSERT_TRUE(rb.try_push(8));
+    ASSERT_TRUE(rb.try_push(9));
+    sched.poll();
+
+    EXPECT_TRUE(t.done());
+    EXPECT_EQ(got, (std::vector<int>{7, 8, 9}));
+    EXPECT_EQ(sched.waiting(), 0u);
+}
+
+TEST(CoroChannel, BatchReturnsAvailableValues) {
+    SpscRingBuffer<int> rb(16);
+    spsc::PollScheduler sched;
+    spsc::Channel<int> ch(rb, sched);
+
+    std::vector<int> got;
+    spsc::Task t = collect_batches(ch, got, 6);
+    sched.spawn(t);
+    EXPECT_TRUE(got.empty());
+
+    for (int i = 0; i < 6; ++i) ASSERT_TRUE(rb.try_push(i));
+
+    // One resume drains up to 4, then the coroutine continues without suspending
+    EXPECT_EQ(sched.poll(), 1u);
+    EXPECT_TRUE(t.done());
+    EXPECT_EQ(got, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+}
+
+TEST(CoroChannel, MultiplexesManyChannelsOnOneThread) {
+    constexpr std::size_t kChannels = 64;
+
+    spsc::PollScheduler sched;
+    std::vector<std::unique_ptr<SpscRingBuffer<std::uint64_t>>> rings;
+    std::vector<spsc::Channel<std::uint64_t>> chans;
+    std::vector<std::uint64_t> sums(kChannels, 0);
+    std::vector<spsc::Task> tasks;
+
+    for (std::size_t i = 0; i < kChannels; ++i) {
+        rings.push_back(std::make_unique<SpscRingBuffer<std::uint64_t>>(8));
+    }
+    for (std::size_t i = 0; i < kChannels; ++i) {
+        chans.emplace_back(*rings[i], sched);
+    }
+    for (std::size_t i = 0; i < kChannels; ++i) {
+        tasks.push_back(sum_forever(chans[i], sums[i]));
+        sched.spawn(tasks.back());
+    }
+    EXPECT_EQ(sched.waiting(), kChannels);
+
+    // Only every 4th channel gets data
+    for (std::size_t i = 0; i < kChannels; i += 4) {
+        ASSERT_TRUE(rings[i]->try_push(i + 1));
+    }
+    EXPECT_EQ(sched.poll(), kChannels / 4);
+
+    for (std::size_t i = 0; i < kChannels; ++i) {
+        EXPECT_EQ(sums[i], (i % 4 == 0) ? i + 1 : 0u);
+    }
+    EXPECT_EQ(sched.waiting(), kChannels);
+}
+
+TEST(CoroChannel, DestroyingParkedTaskUnlinksItsWaiter) {
+    SpscRingBuffer<std::uint64_t> rb_a(8);
+    SpscRingBuffer<std::uint64_t> rb_b(8);
+    SpscRingBuffer<int> rb_c(8);
+    spsc::PollScheduler sched;
+    spsc::Channel<std::uint64_t> ch_a(rb_a, sched);
+    spsc::Channel<std::uint64_t> ch_b(rb_b, sched);
+    spsc::Channel<int> ch_c(rb_c, sched);
+
+    std::uint64_t sum_a = 0;
+    std::uint64_t sum_b = 0;
+    std::vector<int> got;
+
+    spsc::Task a = sum_forever(ch_a, sum_a);
+    spsc::Task c = collect_batches(ch_c, got, 2);
+    sched.spawn(a);
+    sched.spawn(c);
+    {
+        // Parked between a and c, then dropped
+        spsc::Task b = sum_forever(ch_b, sum_b);
+        sched.spawn(b);
+        EXPECT_EQ(sched.waiting(), 3u);
+    }
+    EXPECT_EQ(sched.waiting(), 2u);
+
+    ASSERT_TRUE(rb_a.try_push(5));
+    ASSERT_TRUE(rb_b.try_push(6));
+    ASSERT_TRUE(rb_c.try_push(1));
+    ASSERT_TRUE(rb_c.try_push(2));
+    EXPECT_EQ(sched.poll(), 2u);
+
+    EXPECT_EQ(sum_a, 5u);
+    EXPECT_EQ(sum_b, 0u);
+    EXPECT_TRUE(c.done());
+    EXPECT_EQ(got, (std::vector<int>{1, 2}));
+
+    // Reassigning over a parked task destroys its frame too
+    a = spsc::Task{};
+    EXPECT_EQ(sched.waiting(), 0u);
+    ASSERT_TRUE(rb_a.try_push(7));
+    EXPECT_EQ(sched.poll(), 0u);
+    EXPECT_EQ(sum_a, 5u);
+}
+
+TEST(CoroChannel, FramePoolReusesBlocks) {
+    SpscRingBuffer<int> rb(8);
+    spsc::PollScheduler sched;
+    spsc::Channel<int> ch(rb, sched);
+    auto& pool = spsc::FramePool::local();
+
+    const std::size_t base = pool.in_use();
+    std::vector<int> got;
+
+    {
+        spsc::Task t = collect(ch, got, 1);
+        EXPECT_EQ(pool.in_use(), base + 1);
+    }
+    EXPECT_EQ(pool.in_use(), base);
+
+    const std::size_t cap = pool.capacity();
+    for (int i = 0; i < 1000; ++i) {
+        spsc::Task t = collect(ch, got, 1);
+    }
+    EXPECT_EQ(pool.capacity(), cap);    // no growth: freed frames were reused
+    EXPECT_EQ(pool.oversized(), 0u);
+}
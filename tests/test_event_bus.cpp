@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "event_bus.h"
+#include "latency_tracker.h"
+
+
+TEST(EventBus, RoundTripEchoesEveryEventAcrossRuns) {
+    spsc::EventBus::Options opts;
+    opts.ring_capacity = 64;
+    opts.max_latency_samples = 4096;
+    opts.wait = spsc::WaitStrategy::Yield;
+    opts.round_trip = true;
+    opts.in_flight = 16;
+
+    spsc::EventBus bus(opts);
+    for (int run = 0; run < 2; ++run) {
+        bus.start(3000);
+        bus.join();
+
+        const auto c = bus.counters();
+        EXPECT_EQ(c.produced, 3000u);
+        EXPECT_EQ(c.consumed, 3000u);
+        EXPECT_EQ(c.round_trips, 3000u);
+        EXPECT_EQ(c.seq_mismatch, 0u);
+
+        const auto rtt = bus.rtt_half_stats();
+        EXPECT_EQ(rtt.count, 3000u);
+        EXPECT_EQ(bus.latency_stats().count, 3000u);
+    }
+}
+
+TEST(EventBus, RoundTripHonoursThinkTimeAndStop) {
+    spsc::EventBus::Options opts;
+    opts.ring_capacity = 64;
+    opts.max_latency_samples = 1024;
+    opts.wait = spsc::WaitStrategy::Yield;
+    opts.round_trip = true;
+    opts.think_ns = 20'000;
+
+    // One in flight: every send after the first waits think_ns after the previous reply
+    spsc::EventBus bus(opts);
+    const std::uint64_t t0 = spsc::LatencyTracker::now_ns();
+    bus.start(50);
+    bus.join();
+    EXPECT_GE(spsc::LatencyTracker::now_ns() - t0, 49 * opts.think_ns);
+    EXPECT_EQ(bus.counters().round_trips, 50u);
+
+    // Waiting on replies and think time is not a push failure: the ring never filled
+    EXPECT_EQ(bus.counters().push_fail_spins, 0u);
+
+    // Unbounded run stopped externally: every event sent is still answered
+    bus.start();
+    bus.stop_and_join();
+    const auto c = bus.counters();
+    EXPECT_EQ(c.round_trips, c.produced);
+    EXPECT_EQ(c.consumed, c.produced);
+
+    // One-way buses report no RTT
+    spsc::EventBus one_way(spsc::EventBus::Options{});
+    EXPECT_EQ(one_way.rtt_half_stats().count, 0u);
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "lane_bus.h"
+#include "test_threads.h"
+
+
+namespace {
+
+// Records delivery order; the first event stalls the consumer so every lane fills up behind it
+struct OrderRecorder {
+    std::vector<spsc::EventType> types;
+    std::chrono::milliseconds stall{0};
+
+    void operator()(const spsc::Event& e, std::uint64_t) {
+        if (types.empty() && stall.count() != 0) std::this_thread::sleep_for(stall);
+        types.push_back(e.type);
+    }
+};
+
+// Remembers which threads the handler ran on
+struct ThreadRecorder {
+    std::set<std::uint64_t> threads;
+
+    void operator()(const spsc::Event&, std::uint64_t) { threads.insert(test::thread_serial()); }
+};
+
+spsc::LaneBusOptions small_options() {
+    spsc::LaneBusOptions opts;
+    opts.lane_capacity = 1024;
+    opts.max_latency_samples = 4096;
+    opts.wait = spsc::WaitStrategy::Yield;
+    opts.workload.quotes_per_trade = 3;
+    opts.workload.heartbeat_every = 50;
+    return opts;
+}
+
+}//namespace
+
+
+TEST(LaneWorkload, TypesFollowMixAndBursts) {
+    spsc::LaneWorkload w;
+    w.quotes_per_trade = 2;
+    w.heartbeat_every = 0;
+    w.burst_every = 100;
+    w.burst_len = 20;
+    w.burst_quotes_per_trade = 9;
+
+    EXPECT_TRUE(w.in_burst(0));
+    EXPECT_TRUE(w.in_burst(119));
+    EXPECT_FALSE(w.in_burst(20));
+
+    EXPECT_EQ(w.type_at(0), spsc::EventType::Trade);
+    EXPECT_EQ(w.type_at(9), spsc::EventType::Quote);        // in burst: trade every 10th
+    EXPECT_EQ(w.type_at(10), spsc::EventType::Trade);
+    EXPECT_EQ(w.type_at(21), spsc::EventType::Trade);       // steady: trade every 3rd
+    EXPECT_EQ(w.type_at(22), spsc::EventType::Quote);
+
+    w.heartbeat_every = 8;
+    EXPECT_EQ(w.type_at(7), spsc::EventType::Heartbeat);
+}
+
+TEST(LaneBus, ClassifiesIntoLanesAndTracksEachLane) {
+    const auto opts = small_options();
+    spsc::LaneBus bus(opts);
+
+    ASSERT_EQ(bus.lanes(), 2u);
+    EXPECT_EQ(bus.lane_of(spsc::EventType::Trade), 0u);
+    EXPECT_EQ(bus.lane_of(spsc::EventType::Heartbeat), 0u);
+    EXPECT_EQ(bus.lane_of(spsc::EventType::Quote), 1u);
+
+    constexpr std::uint64_t kEvents = 2000;
+    std::uint64_t expected[2] = {0, 0};
+    for (std::uint64_t seq = 0; seq < kEvents; ++seq) {
+        ++expected[bus.lane_of(opts.workload.type_at(seq))];
+    }
+
+    for (int run = 0; run < 2; ++run) {
+        bus.start(kEvents);
+        bus.join();
+
+        const auto c = bus.counters();
+        EXPECT_EQ(c.produced, kEvents);
+        EXPECT_EQ(c.consumed, kEvents);
+        EXPECT_EQ(c.seq_mismatch, 0u);
+
+        for (std::size_t lane = 0; lane < 2; ++lane) {
+            const auto s = bus.lane_stats(lane);
+            EXPECT_EQ(s.consumed, expected[lane]);
+            EXPECT_EQ(s.latency.count, expected[lane]);
+        }
+    }
+}
+
+TEST(LaneBus, HigherLaneDrainsFirstWithoutStarvationLimit) {
+    auto opts = small_options();
+    opts.starvation_limit = 0;
+    opts.batch = 8;
+
+    spsc::PriorityLaneBus<OrderRecorder> bus(opts, OrderRecorder{{}, std::chrono::milliseconds(50)});
+    bus.start(600);                             // fits in the lanes while the consumer is stalled
+    bus.join();
+
+    // The poll that stalled may have been taken before the lanes filled; after it, every
+    // trade / heartbeat comes out before any quote
+    const auto& types = bus.handler().types;
+    ASSERT_EQ(types.size(), 600u);
+
+    std::size_t first_quote = types.size();
+    for (std::size_t i = opts.batch; i < types.size(); ++i) {
+        if (types[i] == spsc::EventType::Quote) { first_quote = i; break; }
+    }
+    for (std::size_t i = first_quote; i < types.size(); ++i) {
+        EXPECT_EQ(types[i], spsc::EventType::Quote) << "high-priority event at " << i << " after quotes began";
+    }
+    EXPECT_GT(bus.lane_stats(1).max_starved_streak, 0u);
+}
+
+TEST(LaneBus, StarvationLimitBoundsLowLaneWait) {
+    auto opts = small_options();
+    opts.starvation_limit = 3;
+    opts.batch = 4;
+
+    // Trade-heavy: all trades, except half quotes in the first 50 of every 100 events
+    opts.workload.quotes_per_trade = 0;
+    opts.workload.heartbeat_every = 0;
+    opts.workload.burst_every = 100;
+    opts.workload.burst_len = 50;
+    opts.workload.burst_quotes_per_trade = 1;
+
+    spsc::PriorityLaneBus<OrderRecorder> bus(opts, OrderRecorder{{}, std::chrono::milliseconds(50)});
+    bus.start(800);
+    bus.join();
+
+    const auto& types = bus.handler().types;
+    ASSERT_EQ(types.size(), 800u);
+
+    // Quotes are served while trades are still queued
+    std::size_t last_trade = 0;
+    for (std::size_t i = 0; i < types.size(); ++i) {
+        if (types[i] == spsc::EventType::Trade) last_trade = i;
+    }
+    std::size_t quotes_before_last_trade = 0;
+    for (std::size_t i = 0; i < last_trade; ++i) {
+        quotes_before_last_trade += (types[i] == spsc::EventType::Quote);
+    }
+    EXPECT_GT(quotes_before_last_trade, 0u);
+    EXPECT_LE(bus.lane_stats(1).max_starved_streak, opts.starvation_limit);
+}
+
+TEST(LaneBus, SingleLaneIsPlainFifo) {
+    auto opts = small_options();
+    opts.lane_of = {0, 0, 0};
+
+    spsc::PriorityLaneBus<OrderRecorder> bus(opts);
+    ASSERT_EQ(bus.lanes(), 1u);
+
+    bus.start(500);
+    bus.join();
+
+    const auto& types = bus.handler().types;
+    ASSERT_EQ(types.size(), 500u);
+    for (std::uint64_t seq = 0; seq < types.size(); ++seq) {
+        EXPECT_EQ(types[seq], opts.workload.type_at(seq));
+    }
+    EXPECT_EQ(bus.counters().seq_mismatch, 0u);
+}
+
+TEST(LaneBus, ReusesParkedThreadsAcrossRuns) {
+    auto opts = small_options();
+    opts.memory = spsc::MemoryPolicy::Prefault;
+
+    spsc::PriorityLaneBus<ThreadRecorder> bus(opts);
+    bus.launch();
+    bus.launch();                                   // idempotent
+
+    for (int run = 0; run < 3; ++run) {
+        bus.start(300);
+        bus.join();
+        EXPECT_EQ(bus.counters().consumed, 300u);
+        EXPECT_EQ(bus.counters().seq_mismatch, 0u);
+    }
+
+    // Every event of every run went through the same consumer thread
+    ASSERT_EQ(bus.handler().threads.size(), 1u);
+    EXPECT_NE(*bus.handler().threads.begin(), test::thread_serial());
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "event_bus.h"
+#include "outlier_recorder.h"
+
+
+namespace {
+
+spsc::Event make_event(std::uint64_t seq, std::uint64_t enqueue_ns) {
+    spsc::Event e{};
+    e.seq = seq;
+    e.enqueue_ns = enqueue_ns;
+    e.instrument_id = static_cast<std::uint32_t>(seq * 10);
+    e.type = spsc::EventType::Quote;
+    return e;
+}
+
+// Feed latencies through the same wants()/record() pattern the consumer uses
+void feed(spsc::OutlierRecorder& rec, const std::vector<std::uint64_t>& latencies) {
+    for (std::size_t i = 0; i < latencies.size(); ++i) {
+        const std::uint64_t enq = 1000 * i;
+        if (rec.wants(latencies[i])) {
+            rec.record(make_event(i, enq), enq + latencies[i], i);
+        }
+    }
+}
+
+}//namespace
+
+
+TEST(OutlierRecorder, KeepsTopKSlowestWithContext) {
+    spsc::OutlierRecorder rec(3, 0, 0);
+
+    feed(rec, {5, 50, 7, 900, 3, 60, 800, 1});
+
+    const auto top = rec.top();
+    ASSERT_EQ(top.size(), 3u);
+    EXPECT_EQ(top[0].latency_ns, 900u);
+    EXPECT_EQ(top[1].latency_ns, 800u);
+    EXPECT_EQ(top[2].latency_ns, 60u);
+
+    EXPECT_EQ(top[0].seq, 3u);
+    EXPECT_EQ(top[0].instrument_id, 30u);
+    EXPECT_EQ(top[0].type, spsc::EventType::Quote);
+    EXPECT_EQ(top[0].enqueue_ns, 3000u);
+    EXPECT_EQ(top[0].dequeue_ns, 3900u);
+    EXPECT_EQ(top[0].ring_depth, 3u);
+
+    // Once full, anything at or below the current floor is rejected before record()
+    EXPECT_FALSE(rec.wants(60));
+    EXPECT_TRUE(rec.wants(61));
+}
+
+TEST(OutlierRecorder, ThresholdRingKeepsMostRecentInOrder) {
+    spsc::OutlierRecorder rec(0, 100, 2);
+
+    feed(rec, {150, 10, 200, 99, 300});
+
+    EXPECT_EQ(rec.threshold_hits(), 3u);
+    EXPECT_TRUE(rec.top().empty());
+
+    const auto recent = rec.over_threshold();
+    ASSERT_EQ(recent.size(), 2u);
+    EXPECT_EQ(recent[0].latency_ns, 200u);
+    EXPECT_EQ(recent[1].latency_ns, 300u);
+}
+
+TEST(OutlierRecorder, SnapshotOnlyAfterRequestAndService) {
+    spsc::OutlierRecorder rec(4, 0, 0);
+    feed(rec, {10, 20, 30});
+
+    std::vector<spsc::OutlierRecord> top, over;
+    EXPECT_FALSE(rec.take_snapshot(top, over));
+
+    rec.service_snapshot();                 // nothing requested: no-op
+    EXPECT_FALSE(rec.take_snapshot(top, over));
+
+    rec.request_snapshot();
+    EXPECT_FALSE(rec.take_snapshot(top, over));
+    rec.service_snapshot();
+
+    ASSERT_TRUE(rec.take_snapshot(top, over));
+    ASSERT_EQ(top.size(), 3u);
+    EXPECT_EQ(top[0].latency_ns, 30u);
+    EXPECT_FALSE(rec.take_snapshot(top, over));
+}
+
+TEST(OutlierRecorder, ConcurrentReadersEachGetAWholeSnapshot) {
+    spsc::OutlierRecorder rec(64, 0, 0);
+    std::atomic<bool> done{false};
+
+    // Consumer: latencies keep climbing, so every publish rewrites the whole top-K
+    std::thread consumer([&] {
+        for (std::uint64_t i = 0; !done.load(std::memory_order_acquire); ++i) {
+            const std::uint64_t latency = 100 + i;
+            if (rec.wants(latency)) rec.record(make_event(i, 1000 * i), 1000 * i + latency, 0);
+            rec.service_snapshot();
+            if ((i & 0xFF) == 0) std::this_thread::yield();
+        }
+    });
+
+    std::atomic<std::uint64_t> taken{0};
+    auto reader = [&] {
+        std::vector<spsc::OutlierRecord> top, over;
+        while (taken.load(std::memory_order_relaxed) < 200) {
+            rec.request_snapshot();
+            if (!rec.take_snapshot(top, over)) {
+                std::this_thread::yield();
+                continue;
+            }
+            taken.fetch_add(1, std::memory_order_relaxed);
+
+            // Every record intact and the set sorted slowest first
+            ASSERT_FALSE(top.empty());
+            for (const auto& r : top) {
+                ASSERT_EQ(r.dequeue_ns - r.enqueue_ns, r.latency_ns);
+                ASSERT_EQ(r.latency_ns, 100 + r.seq);
+            }
+            ASSERT_TRUE(std::is_sorted(top.begin(), top.end(),
+                                       [](const auto& a, const auto& b) { return a.latency_ns > b.latency_ns; }));
+        }
+    };
+
+    std::thread a(reader), b(reader);
+    a.join();
+    b.join();
+    done.store(true, std::memory_order_release);
+    consumer.join();
+
+    EXPECT_GE(taken.load(), 200u);
+}
+
+TEST(OutlierRecorder, ResetAndDump) {
+    spsc::OutlierRecorder rec(2, 0, 0);
+    feed(rec, {10, 20, 30});
+
+    std::ostringstream out;
+    rec.dump(out);
+    EXPECT_NE(out.str().find("Slowest events (2 of 2 kept)"), std::string::npos);
+
+    rec.reset();
+    EXPECT_TRUE(rec.top().empty());
+    EXPECT_TRUE(rec.wants(1));
+}
+
+TEST(OutlierRecorder, EventBusRecordsSlowestEvents) {
+    spsc::EventBus::Options opts;
+    opts.ring_capacity = 256;
+    opts.max_latency_samples = 8192;       // > events, so the tracker sees the whole run too
+    opts.wait = spsc::WaitStrategy::Yield;
+    opts.outlier_top_k = 8;
+
+    spsc::EventBus bus(opts);
+    bus.start(5000);
+    bus.join();
+
+    const auto top = bus.outliers().top();
+    ASSERT_EQ(top.size(), 8u);
+    EXPECT_GE(top.front().latency_ns, top.back().latency_ns);
+    EXPECT_EQ(top.front().latency_ns, bus.latency_stats().max_ns);
+    EXPECT_LE(top.front().ring_depth, 256u);
+}
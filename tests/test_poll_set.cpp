@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "poll_set.h"
+
+
+TEST(PollSet, EmptySetPollsNothing) {
+    spsc::PollSet<int> ps(100, 8);
+
+    int calls = 0;
+    EXPECT_EQ(ps.poll([&](std::size_t, int&) { ++calls; }), 0u);
+    EXPECT_EQ(calls, 0);
+}
+
+TEST(PollSet, PushFlagsRingAndPollDrainsOnlyReadyRings) {
+    spsc::PollSet<int> ps(130, 8);      // spans three bitmap words
+
+    ASSERT_TRUE(ps.try_push(3, 30));
+    ASSERT_TRUE(ps.try_push(129, 1290));
+    EXPECT_TRUE(ps.ready(3));
+    EXPECT_TRUE(ps.ready(129));
+    EXPECT_FALSE(ps.ready(4));
+
+    std::vector<std::pair<std::size_t, int>> got;
+    EXPECT_EQ(ps.poll([&](std::size_t ring, int& v) { got.emplace_back(ring, v); }), 2u);
+
+    ASSERT_EQ(got.size(), 2u);
+    EXPECT_EQ(got[0], (std::pair<std::size_t, int>{3, 30}));
+    EXPECT_EQ(got[1], (std::pair<std::size_t, int>{129, 1290}));
+    EXPECT_FALSE(ps.ready(3));
+    EXPECT_FALSE(ps.ready(129));
+    EXPECT_EQ(ps.stats(3).consumed, 1u);
+}
+
+TEST(PollSet, BatchLimitKeepsRingFlagged) {
+    spsc::PollSet<int>::Options opts;
+    opts.batch = 2;
+    spsc::PollSet<int> ps(4, 16, opts);
+
+    for (int i = 0; i < 5; ++i) ASSERT_TRUE(ps.try_push(1, i));
+
+    std::vector<int> got;
+    auto h = [&](std::size_t, int& v) { got.push_back(v); };
+
+    EXPECT_EQ(ps.poll(h), 2u);
+    EXPECT_TRUE(ps.ready(1));
+    EXPECT_EQ(ps.poll(h), 2u);
+    EXPECT_EQ(ps.poll(h), 1u);
+    EXPECT_FALSE(ps.ready(1));
+    EXPECT_EQ(got, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST(PollSet, RoundRobinRotatesStartingRing) {
+    spsc::PollSet<int>::Options opts;
+    opts.batch = 1;
+    spsc::PollSet<int> ps(3, 16, opts);
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(ps.try_push(0, 0));
+        ASSERT_TRUE(ps.try_push(1, 1));
+        ASSERT_TRUE(ps.try_push(2, 2));
+    }
+
+    // Budget 1 per poll: rings take turns instead of ring 0 winning every time
+    std::vector<std::size_t> order;
+    auto h = [&](std::size_t ring, int&) { order.push_back(ring); };
+    for (int i = 0; i < 6; ++i) ps.poll(h, 1);
+
+    EXPECT_EQ(order, (std::vector<std::size_t>{0, 1, 2, 0, 1, 2}));
+    EXPECT_EQ(ps.stats(2).starved_polls, 4u);
+}
+
+TEST(PollSet, PriorityServesLowestIndexFirst) {
+    spsc::PollSet<int>::Options opts;
+    opts.policy = spsc::PollPolicy::Priority;
+    spsc::PollSet<int> ps(3, 16, opts);
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ps.try_push(2, 2));
+        ASSERT_TRUE(ps.try_push(0, 0));
+    }
+
+    std::vector<std::size_t> order;
+    auto h = [&](std::size_t ring, int&) { order.push_back(ring); };
+
+    EXPECT_EQ(ps.poll(h, 4), 4u);
+    EXPECT_EQ(order, (std::vector<std::size_t>{0, 0, 0, 0}));
+    EXPECT_EQ(ps.stats(2).starved_polls, 1u);
+    EXPECT_EQ(ps.stats(2).max_starved_streak, 1u);
+}
+
+TEST(PollSet, StarvationLimitBoundsLowPriorityWait) {
+    spsc::PollSet<int>::Options opts;
+    opts.policy = spsc::PollPolicy::Priority;
+    opts.batch = 1;
+    opts.starvation_limit = 3;
+    spsc::PollSet<int> ps(2, 64, opts);
+
+    ASSERT_TRUE(ps.try_push(1, 100));
+
+    std::vector<std::size_t> order;
+    auto h = [&](std::size_t ring, int&) { order.push_back(ring); };
+
+    // Ring 0 always has data; ring 1 must still get through within limit + 1 polls
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(ps.try_push(0, i));
+        ps.poll(h, 1);
+    }
+
+    EXPECT_EQ(order, (std::vector<std::size_t>{0, 0, 0, 1, 0}));
+    EXPECT_EQ(ps.stats(1).consumed, 1u);
+    EXPECT_EQ(ps.stats(1).max_starved_streak, 3u);
+}
+
+TEST(PollSet, ThreadedProducersNoLostEvents) {
+    constexpr std::size_t kRings = 8;
+    constexpr std::uint64_t kPerRing = 20000;
+
+    spsc::PollSet<std::uint64_t> ps(kRings, 256);
+
+    std::vector<std::thread> producers;
+    for (std::size_t r = 0; r < kRings; ++r) {
+        producers.emplace_back([&, r] {
+            for (std::uint64_t i = 0; i < kPerRing;) {
+                if (ps.try_push(r, i)) ++i;
+                else std::this_thread::yield();
+            }
+        });
+    }
+
+    std::vector<std::uint64_t> expected(kRings, 0);
+    std::uint64_t total = 0;
+    bool in_order = true;
+
+    while (total < kRings * kPerRing) {
+        const std::size_t n = ps.poll([&](std::size_t ring, std::uint64_t& v) {
+            in_order &= (v == expected[ring]);
+            ++expected[ring];
+        });
+        if (n == 0) std::this_thread::yield();
+        total += n;
+    }
+
+    for (auto& t : producers) t.join();
+
+    EXPECT_TRUE(in_order);
+    for (std::size_t r = 0; r < kRings; ++r) {
+        EXPECT_EQ(ps.stats(r).consumed, kPerRing);
+    }
+}
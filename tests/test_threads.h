@@ -0,0 +1,15 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace test {
+
+// Process-unique serial of the calling thread. Unlike std::thread::id, never reused by a new thread.
+inline std::uint64_t thread_serial() {
+    static std::atomic<std::uint64_t> next{0};
+    thread_local const std::uint64_t serial = next.fetch_add(1) + 1;
+    return serial;
+}
+
+}//namespace test
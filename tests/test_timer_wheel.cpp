@@ -0,0 +1,264 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "event_bus.h"
+#include "feed_monitor.h"
+#include "timer_wheel.h"
+
+
+namespace {
+
+constexpr unsigned kShift = 10;                     // 1024ns ticks
+constexpr std::uint64_t kTick = 1u << kShift;
+
+struct Fired {
+    std::vector<std::uint64_t> args;
+    std::vector<std::uint64_t> at_ns;
+};
+
+void on_fire(void* ctx, std::uint64_t arg, std::uint64_t now_ns) {
+    auto* f = static_cast<Fired*>(ctx);
+    f->args.push_back(arg);
+    f->at_ns.push_back(now_ns);
+}
+
+// Cancels another timer when it fires
+struct Canceller {
+    spsc::TimerWheel* tw{nullptr};
+    spsc::TimerWheel::TimerId victim{spsc::TimerWheel::kInvalidTimer};
+    Fired fired{};
+    bool cancelled{false};
+};
+
+void on_fire_cancel(void* ctx, std::uint64_t arg, std::uint64_t now_ns) {
+    auto* c = static_cast<Canceller*>(ctx);
+    on_fire(&c->fired, arg, now_ns);
+    if (arg == 3) c->cancelled = c->tw->cancel(c->victim);
+}
+
+}//namespace
+
+
+TEST(TimerWheel, FiresAtOrAfterDeadlineNeverBefore) {
+    spsc::TimerWheel tw(16, 0, kShift);
+    Fired f;
+
+    tw.schedule_at(10 * kTick, on_fire, &f, 1);
+    tw.schedule_at(10 * kTick + 1, on_fire, &f, 2);     // rounds up to tick 11
+
+    EXPECT_EQ(tw.advance(10 * kTick - 1), 0u);
+    EXPECT_EQ(tw.advance(10 * kTick), 1u);
+    EXPECT_EQ(f.args, (std::vector<std::uint64_t>{1}));
+
+    EXPECT_EQ(tw.advance(11 * kTick - 1), 0u);
+    EXPECT_EQ(tw.advance(11 * kTick), 1u);
+    EXPECT_EQ(f.args, (std::vector<std::uint64_t>{1, 2}));
+    EXPECT_EQ(tw.active(), 0u);
+}
+
+TEST(TimerWheel, CascadesAcrossAllLevels) {
+    spsc::TimerWheel tw(16, 0, kShift);
+    Fired f;
+
+    // One timer per level (ticks 200, 70'000, 20'000'000, 3'000'000'000) plus one beyond range
+    const std::vector<std::uint64_t> ticks = {200, 70'000, 20'000'000, 3'000'000'000ull, (1ull << 33) + 5};
+    for (std::size_t i = 0; i < ticks.size(); ++i) {
+        tw.schedule_at(ticks[i] * kTick, on_fire, &f, i);
+    }
+
+    for (std::size_t i = 0; i < ticks.size(); ++i) {
+        EXPECT_EQ(tw.advance(ticks[i] * kTick - 1), 0u) << "timer " << i << " fired early";
+        EXPECT_EQ(tw.advance(ticks[i] * kTick), 1u) << "timer " << i << " did not fire on time";
+    }
+    EXPECT_EQ(f.args, (std::vector<std::uint64_t>{0, 1, 2, 3, 4}));
+}
+
+TEST(TimerWheel, LargeJumpFiresEverythingDueInOrder) {
+    spsc::TimerWheel tw(1024, 0, kShift);
+    Fired f;
+
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        tw.schedule_at((1000 - i) * 97 * kTick, on_fire, &f, 1000 - i);
+    }
+
+    EXPECT_EQ(tw.advance(2'000'000 * kTick), 1000u);
+    ASSERT_EQ(f.args.size(), 1000u);
+    for (std::size_t i = 0; i < f.args.size(); ++i) {
+        EXPECT_EQ(f.args[i], i + 1);
+    }
+}
+
+TEST(TimerWheel, RandomDeadlinesFireInTheRightAdvance) {
+    spsc::TimerWheel tw(4096, 0, kShift);
+    std::mt19937_64 rng(1);
+
+    // Deadlines spread over all levels; advance in random strides
+    std::vector<std::uint64_t> deadline(4096);
+    Fired f;
+    for (std::uint64_t i = 0; i < deadline.size(); ++i) {
+        deadline[i] = (1 + rng() % (std::uint64_t{1} << (8 + rng() % 26))) * kTick;
+        tw.schedule_at(deadline[i], on_fire, &f, i);
+    }
+
+    std::uint64_t prev = 0;
+    std::uint64_t now = 0;
+    while (tw.active() != 0) {
+        now += 1 + rng() % (std::uint64_t{1} << (rng() % 34));
+        const std::size_t before = f.args.size();
+        tw.advance(now);
+        for (std::size_t k = before; k < f.args.size(); ++k) {
+            const std::uint64_t d = deadline[f.args[k]];
+            ASSERT_LE(d, now) << "timer " << f.args[k] << " fired early";
+            ASSERT_GT(d, prev) << "timer " << f.args[k] << " fired late";
+        }
+        prev = now;
+    }
+    EXPECT_EQ(f.args.size(), deadline.size());
+}
+
+TEST(TimerWheel, CancelIsO1AndRejectsStaleHandles) {
+    spsc::TimerWheel tw(4, 0, kShift);
+    Fired f;
+
+    const auto a = tw.schedule_at(5 * kTick, on_fire, &f, 1);
+    const auto b = tw.schedule_at(5 * kTick, on_fire, &f, 2);
+    ASSERT_NE(a, spsc::TimerWheel::kInvalidTimer);
+
+    EXPECT_TRUE(tw.cancel(a));
+    EXPECT_FALSE(tw.cancel(a));             // already cancelled
+    EXPECT_EQ(tw.active(), 1u);
+
+    // The freed node is reused; the old handle must not cancel the new timer
+    const auto c = tw.schedule_at(6 * kTick, on_fire, &f, 3);
+    EXPECT_FALSE(tw.cancel(a));
+
+    tw.advance(10 * kTick);
+    EXPECT_EQ(f.args, (std::vector<std::uint64_t>{2, 3}));
+    EXPECT_FALSE(tw.cancel(b));             // already fired
+    EXPECT_FALSE(tw.cancel(c));
+}
+
+TEST(TimerWheel, PoolExhaustionAndCallbackReschedule) {
+    spsc::TimerWheel tw(2, 0, kShift);
+    Fired f;
+
+    EXPECT_NE(tw.schedule_at(kTick, on_fire, &f, 1), spsc::TimerWheel::kInvalidTimer);
+    EXPECT_NE(tw.schedule_at(kTick, on_fire, &f, 2), spsc::TimerWheel::kInvalidTimer);
+    EXPECT_EQ(tw.schedule_at(kTick, on_fire, &f, 3), spsc::TimerWheel::kInvalidTimer);
+
+    tw.advance(kTick);
+    EXPECT_EQ(tw.active(), 0u);
+
+    tw.reset(100 * kTick);
+    EXPECT_EQ(tw.advance(50 * kTick), 0u);  // time never goes backwards
+    EXPECT_EQ(tw.now_ns(), 100 * kTick);
+}
+
+TEST(TimerWheel, CallbackCancelsTimerDueInTheSameTick) {
+    spsc::TimerWheel tw(4, 0, kShift);
+    Canceller c{&tw};
+
+    // Same slot: 3 fires first (newest at the head) and cancels 2, still queued behind it
+    tw.schedule_at(5 * kTick, on_fire_cancel, &c, 1);
+    c.victim = tw.schedule_at(5 * kTick, on_fire_cancel, &c, 2);
+    tw.schedule_at(5 * kTick, on_fire_cancel, &c, 3);
+
+    EXPECT_EQ(tw.advance(5 * kTick), 2u);
+    EXPECT_TRUE(c.cancelled);
+    EXPECT_EQ(c.fired.args, (std::vector<std::uint64_t>{3, 1}));
+    EXPECT_EQ(tw.active(), 0u);
+
+    // Free list intact: the whole pool schedules again and fires once each
+    Fired f;
+    for (std::uint64_t i = 0; i < tw.capacity(); ++i) {
+        EXPECT_NE(tw.schedule_at(7 * kTick, on_fire, &f, i), spsc::TimerWheel::kInvalidTimer);
+    }
+    EXPECT_EQ(tw.schedule_at(7 * kTick, on_fire, &f, 9), spsc::TimerWheel::kInvalidTimer);
+    EXPECT_EQ(tw.active(), tw.capacity());
+
+    EXPECT_EQ(tw.advance(8 * kTick), tw.capacity());
+    EXPECT_EQ(f.args.size(), tw.capacity());
+    EXPECT_EQ(tw.active(), 0u);
+}
+
+TEST(FeedMonitor, HeartbeatsOnFixedSchedule) {
+    spsc::TimerWheel tw(8, 0, kShift);
+    spsc::FeedMonitor fm(tw, 4, 0, 100 * kTick);
+    fm.start();
+
+    tw.advance(99 * kTick);
+    EXPECT_EQ(fm.heartbeats(), 0u);
+    tw.advance(100 * kTick);
+    EXPECT_EQ(fm.heartbeats(), 1u);
+    tw.advance(200 * kTick);
+    tw.advance(300 * kTick);
+    EXPECT_EQ(fm.heartbeats(), 3u);
+    EXPECT_EQ(tw.active(), 1u);             // next beat armed
+
+    // A late advance fires one beat and skips the missed ones rather than bursting
+    tw.advance(1000 * kTick);
+    EXPECT_EQ(fm.heartbeats(), 4u);
+    tw.advance(1099 * kTick);
+    EXPECT_EQ(fm.heartbeats(), 4u);
+    tw.advance(1100 * kTick);
+    EXPECT_EQ(fm.heartbeats(), 5u);
+}
+
+TEST(FeedMonitor, DetectsStaleInstrumentsAndRearmsOnActivity) {
+    struct Seen { std::vector<std::uint32_t> ids; } seen;
+
+    spsc::FeedMonitor::Hooks hooks;
+    hooks.ctx = &seen;
+    hooks.on_stale = [](void* ctx, std::uint32_t id, std::uint64_t, std::uint64_t) {
+        static_cast<Seen*>(ctx)->ids.push_back(id);
+    };
+
+    const std::uint64_t stale_after = 100 * kTick;
+    spsc::TimerWheel tw(8, 0, kShift);
+    spsc::FeedMonitor fm(tw, 4, stale_after, 0, hooks);
+
+    // Instrument 1 keeps ticking, instrument 2 goes quiet
+    std::uint64_t now = 0;
+    fm.on_event(1, now);
+    fm.on_event(2, now);
+    for (int i = 0; i < 30; ++i) {
+        now += 10 * kTick;
+        fm.on_event(1, now);
+        tw.advance(now);
+    }
+
+    EXPECT_EQ(seen.ids, (std::vector<std::uint32_t>{2}));
+    EXPECT_EQ(fm.stale_events(), 1u);
+
+    // Instrument 2 comes back and keeps ticking while instrument 1 goes quiet
+    for (int i = 0; i < 30; ++i) {
+        now += 10 * kTick;
+        fm.on_event(2, now);
+        tw.advance(now);
+    }
+    EXPECT_EQ(seen.ids, (std::vector<std::uint32_t>{2, 1}));
+
+    // Ids outside the table are ignored
+    fm.on_event(99, now);
+    EXPECT_EQ(fm.timer_pool_exhausted(), 0u);
+}
+
+TEST(FeedMonitor, EventBusCountsHeartbeats) {
+    spsc::EventBus::Options opts;
+    opts.ring_capacity = 256;
+    opts.wait = spsc::WaitStrategy::Yield;
+    opts.heartbeat_every_ns = 1000;
+    opts.stale_after_ns = 1'000'000'000;    // nothing goes stale within the run
+
+    spsc::EventBus bus(opts);
+    bus.start(5000);
+    bus.join();
+
+    const auto c = bus.counters();
+    EXPECT_EQ(c.consumed, 5000u);
+    EXPECT_GT(c.heartbeats, 0u);
+    EXPECT_EQ(c.stale_events, 0u);
+}
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "topology.h"
+#include "test_threads.h"
+
+
+namespace {
+
+// Consumer threads seen by a bus, recorded from its heartbeat hook
+struct ThreadLog {
+    std::mutex mu;
+    std::set<std::uint64_t> threads;
+
+    static void on_heartbeat(void* ctx, std::uint64_t) {
+        auto* log = static_cast<ThreadLog*>(ctx);
+        const std::uint64_t serial = test::thread_serial();
+        const std::lock_guard<std::mutex> lock(log->mu);
+        log->threads.insert(serial);
+    }
+};
+
+}//namespace
+
+
+TEST(TopologyConfig, ParsesRuntimeAndBuses) {
+    std::istringstream in(R"(
+        # comment line
+        [runtime]
+        warmup_events = 1000
+        events = 5000      # trailing comment
+
+        [bus md]
+        ring_capacity = 1024
+        max_latency_samples = 4096
+        producer_core = 2
+        consumer_core = 3
+        wait = spin
+        memory = prefault
+
+        [bus ref]
+        wait = yield
+        round_trip = true
+        in_flight = 8
+        think_ns = 500
+    )");
+
+    const auto cfg = spsc::TopologyConfig::parse(in);
+
+    EXPECT_EQ(cfg.warmup_events, 1000u);
+    EXPECT_EQ(cfg.events, 5000u);
+    ASSERT_EQ(cfg.buses.size(), 2u);
+
+    const auto& md = cfg.buses[0];
+    EXPECT_EQ(md.name, "md");
+    EXPECT_EQ(md.options.ring_capacity, 1024u);
+    EXPECT_EQ(md.options.max_latency_samples, 4096u);
+    EXPECT_EQ(md.options.producer_core, 2);
+    EXPECT_EQ(md.options.consumer_core, 3);
+    EXPECT_EQ(md.options.wait, spsc::WaitStrategy::Spin);
+    EXPECT_EQ(md.options.memory, spsc::MemoryPolicy::Prefault);
+
+    // Unset keys keep EventBus::Options defaults
+    const auto& ref = cfg.buses[1];
+    EXPECT_EQ(ref.name, "ref");
+    EXPECT_EQ(ref.options.ring_capacity, spsc::EventBus::Options{}.ring_capacity);
+    EXPECT_EQ(ref.options.producer_core, -1);
+    EXPECT_EQ(ref.options.wait, spsc::WaitStrategy::Yield);
+    EXPECT_EQ(ref.options.memory, spsc::MemoryPolicy::Lazy);
+    EXPECT_TRUE(ref.options.round_trip);
+    EXPECT_EQ(ref.options.in_flight, 8u);
+    EXPECT_EQ(ref.options.think_ns, 500u);
+    EXPECT_FALSE(md.options.round_trip);
+}
+
+TEST(TopologyConfig, RejectsBadInput) {
+    auto parse = [](const char* text) {
+        std::istringstream in(text);
+        return spsc::TopologyConfig::parse(in);
+    };
+
+    EXPECT_THROW(parse(""), std::runtime_error);                                    // no buses
+    EXPECT_THROW(parse("[bus]\n"), std::runtime_error);                             // unnamed bus
+    EXPECT_THROW(parse("[bus a]\n[bus a]\n"), std::runtime_error);                  // duplicate
+    EXPECT_THROW(parse("[bus a]\nring_capacity = lots\n"), std::runtime_error);     // not an int
+    EXPECT_THROW(parse("[bus a]\nwait = sleep\n"), std::runtime_error);             // unknown enum
+    EXPECT_THROW(parse("[bus a]\nround_trip = maybe\n"), std::runtime_error);       // not a bool
+    EXPECT_THROW(parse("[bus a]\ncolour = red\n"), std::runtime_error);             // unknown key
+    EXPECT_THROW(parse("events = 1\n[bus a]\n"), std::runtime_error);               // no section
+    EXPECT_THROW(parse("[network]\n"), std::runtime_error);                         // unknown section
+
+    // Sizes are range-checked at parse time
+    EXPECT_THROW(parse("[bus a]\nring_capacity = 0\n"), std::runtime_error);
+    EXPECT_THROW(parse("[bus a]\nring_capacity = 18446744073709551615\n"), std::runtime_error);
+    EXPECT_THROW(parse("[bus a]\nmax_latency_samples = 0\n"), std::runtime_error);
+    EXPECT_THROW(parse("[bus a]\ntrace_capacity = 0\n"), std::runtime_error);
+    EXPECT_THROW(parse("[bus a]\nin_flight = 0\n"), std::runtime_error);
+    EXPECT_THROW(parse("[bus a]\nin_flight = 64\nring_capacity = 16\n"), std::runtime_error);
+    EXPECT_NO_THROW(parse("[bus a]\nin_flight = 16\nring_capacity = 16\n"));
+
+    try {
+        parse("[bus a]\nwait = spin\ntrace_capacity = 0\n");
+        ADD_FAILURE() << "expected a parse error";
+    }
+    catch (const std::runtime_error& ex) {
+        EXPECT_NE(std::string(ex.what()).find("line 3"), std::string::npos) << ex.what();
+    }
+
+#if SPSC_UDP_INGEST
+    // A UDP feed never ends on its own: the run needs an event target
+    EXPECT_THROW(parse("[bus a]\nudp_listen = 127.0.0.1:0\n"), std::runtime_error);
+    EXPECT_NO_THROW(parse("[runtime]\nevents = 10\n[bus a]\nudp_listen = 127.0.0.1:0\n"));
+#endif
+}
+
+TEST(Topology, WarmsUpAndReusesThreadsAcrossRuns) {
+    std::istringstream in(R"(
+        [runtime]
+        warmup_events = 2000
+
+        [bus a]
+        ring_capacity = 256
+        max_latency_samples = 1024
+        wait = yield
+        memory = prefault
+
+        [bus b]
+        ring_capacity = 256
+        max_latency_samples = 1024
+        wait = yield
+    )");
+
+    auto cfg = spsc::TopologyConfig::parse(in);
+
+    // A 1us heartbeat fires on the consumer thread during every run
+    std::vector<ThreadLog> logs(cfg.buses.size());
+    for (std::size_t i = 0; i < cfg.buses.size(); ++i) {
+        cfg.buses[i].options.heartbeat_every_ns = 1'000;
+        cfg.buses[i].options.feed_hooks = spsc::FeedHooks{&ThreadLog::on_heartbeat, nullptr, &logs[i]};
+    }
+
+    spsc::Topology topo{std::move(cfg)};
+
+    const auto& ready = topo.ready_report();
+    EXPECT_GT(ready.total_ns, 0u);
+    EXPECT_GE(ready.total_ns, ready.build_ns + ready.launch_ns + ready.warmup_ns);
+
+    // Warmup ran to completion on every bus
+    for (std::size_t i = 0; i < topo.size(); ++i) {
+        EXPECT_FALSE(topo.bus(i).running());
+        EXPECT_EQ(topo.bus(i).counters().consumed, 2000u);
+    }
+
+    // Several start/join cycles on the same parked threads; stats reset each run
+    for (std::uint64_t run = 1; run <= 3; ++run) {
+        topo.start(run * 1000);
+        topo.join();
+
+        for (std::size_t i = 0; i < topo.size(); ++i) {
+            const auto c = topo.bus(i).counters();
+            EXPECT_EQ(c.produced, run * 1000);
+            EXPECT_EQ(c.consumed, run * 1000);
+            EXPECT_EQ(c.seq_mismatch, 0u);
+        }
+    }
+
+    // Warmup and all three runs were served by one consumer thread per bus, not the caller
+    for (auto& log : logs) {
+        const std::lock_guard<std::mutex> lock(log.mu);
+        ASSERT_EQ(log.threads.size(), 1u);
+        EXPECT_NE(*log.threads.begin(), test::thread_serial());
+    }
+    EXPECT_NE(*logs[0].threads.begin(), *logs[1].threads.begin());
+}
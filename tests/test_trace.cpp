@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "event_bus.h"
+#include "trace.h"
+
+
+namespace {
+
+std::size_t count_of(const std::string& s, const std::string& needle) {
+    std::size_t n = 0;
+    for (auto pos = s.find(needle); pos != std::string::npos; pos = s.find(needle, pos + 1)) ++n;
+    return n;
+}
+
+}//namespace
+
+
+TEST(TraceBuffer, KeepsMostRecentSpans) {
+    spsc::TraceBuffer tb(3);
+
+    for (std::uint64_t i = 0; i < 5; ++i) {
+        tb.record(spsc::Hop::Ring, i, i * 10, i * 10 + 5);
+    }
+
+    ASSERT_EQ(tb.size(), 3u);
+    EXPECT_EQ(tb.overwritten(), 2u);
+    EXPECT_EQ(tb[0].seq, 2u);
+    EXPECT_EQ(tb[1].seq, 3u);
+    EXPECT_EQ(tb[2].seq, 4u);
+    EXPECT_EQ(tb[2].begin_ns, 40u);
+    EXPECT_EQ(tb[2].end_ns, 45u);
+
+    tb.clear();
+    EXPECT_EQ(tb.size(), 0u);
+}
+
+TEST(ChromeTraceWriter, EmitsCompleteEventsPerHopTrack) {
+    spsc::TraceBuffer tb(8);
+    tb.record(spsc::Hop::Produce, 7, 1000, 1500);
+    tb.record(spsc::Hop::Handle, 7, 3000, 3250);
+
+    std::ostringstream out;
+    {
+        spsc::ChromeTraceWriter w(out);
+        w.add_process(1, "md");
+        w.add(tb, 1);
+    }
+
+    const std::string json = out.str();
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("\n]}"), std::string::npos);
+
+    EXPECT_EQ(count_of(json, "\"ph\":\"X\""), 2u);
+    EXPECT_EQ(count_of(json, "\"name\":\"thread_name\""), spsc::kHopCount);
+    EXPECT_NE(json.find("\"name\":\"produce\",\"pid\":1,\"tid\":1,\"ts\":1.000,\"dur\":0.500,\"args\":{\"seq\":7}"),
+              std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"handle\",\"pid\":1,\"tid\":3,\"ts\":3.000,\"dur\":0.250"), std::string::npos);
+}
+
+TEST(ChromeTraceWriter, EscapesProcessNames) {
+    std::ostringstream out;
+    {
+        spsc::ChromeTraceWriter w(out);
+        w.add_process(2, "md \"a\"\\b\t\x01");
+    }
+
+    EXPECT_NE(out.str().find("\"args\":{\"name\":\"md \\\"a\\\"\\\\b\\t\\u0001\"}}"), std::string::npos);
+}
+
+// Built both ways: without SPSC_TRACING the bus keeps no spans and writes none
+TEST(EventBusTracing, SamplesEveryNthEventAtEachHop) {
+    constexpr std::uint64_t kSamples = SPSC_TRACING ? 100 : 0;
+
+    spsc::EventBus::Options opts;
+    opts.ring_capacity = 256;
+    opts.max_latency_samples = 4096;
+    opts.wait = spsc::WaitStrategy::Yield;
+    opts.trace_sample_every = 16;
+
+    spsc::EventBus bus(opts);
+    bus.start(1600);
+    bus.join();
+
+    const auto hops = bus.hop_stats();
+    EXPECT_EQ(hops.ring.count, 1600u);
+    EXPECT_EQ(hops.produce.count, kSamples);
+    EXPECT_EQ(hops.handle.count, kSamples);
+
+    std::ostringstream out;
+    {
+        spsc::ChromeTraceWriter w(out);
+        bus.write_trace(w, 1, "bus");
+    }
+
+    // produce span per sample on the producer thread, ring + handle spans on the consumer thread
+    EXPECT_EQ(count_of(out.str(), "\"ph\":\"X\""), 3 * kSamples);
+}
+
+TEST(EventBusTracing, ZeroSampleRateDisablesTracing) {
+    spsc::EventBus::Options opts;
+    opts.ring_capacity = 256;
+    opts.max_latency_samples = 1024;
+    opts.wait = spsc::WaitStrategy::Yield;
+    opts.trace_sample_every = 0;
+
+    spsc::EventBus bus(opts);
+    bus.start(500);
+    bus.join();
+
+    const auto hops = bus.hop_stats();
+    EXPECT_EQ(hops.ring.count, 500u);
+    EXPECT_EQ(hops.produce.count, 0u);
+    EXPECT_EQ(hops.handle.count, 0u);
+}
@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "event_bus.h"
+#include "feed_packet.h"
+#include "latency_tracker.h"
+
+// The wire format is portable; the socket side only exists with SPSC_UDP_INGEST
+#if SPSC_UDP_INGEST
+#include "udp_ingest.h"
+
+
+namespace {
+
+std::string loopback(std::uint16_t port) {
+    return "127.0.0.1:" + std::to_string(port);
+}
+
+// Poll until `want` datagrams arrived or ~2s passed
+std::vector<std::vector<spsc::Event>> receive_all(spsc::UdpIngest& in, std::size_t want) {
+    std::vector<std::vector<spsc::Event>> out;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+
+    while (out.size() < want && std::chrono::steady_clock::now() < deadline) {
+        const std::size_t n = in.receive();
+        if (n == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto p = in.packet(i);
+            spsc::wire::PacketHeader h;
+            auto& events = out.emplace_back();
+            EXPECT_TRUE(spsc::wire::decode_packet(p.data, p.len, p.rx_ns, h,
+                                                  [&](const spsc::Event& e) { events.push_back(e); }));
+            EXPECT_LE(p.rx_ns, spsc::LatencyTracker::now_ns());
+        }
+    }
+    return out;
+}
+
+}//namespace
+#endif
+
+
+TEST(FeedPacket, EncodesLittleEndianOnTheWire) {
+    spsc::Event in{};
+    in.seq = 0x0102030405060708ull;
+    in.instrument_id = 0x0A0B0C0D;
+    in.price_ticks = -2;
+
+    std::byte buf[spsc::wire::kMaxDatagram];
+    ASSERT_NE(spsc::wire::encode_packet(buf, sizeof(buf), 0x1122334455667788ull, 0, &in, 1), 0u);
+
+    auto at = [&](std::size_t i) { return std::to_integer<unsigned>(buf[i]); };
+    EXPECT_EQ(at(0), 0x45u);                    // magic 0x4245, low byte first
+    EXPECT_EQ(at(1), 0x42u);
+    EXPECT_EQ(at(8), 0x88u);                    // packet_seq
+    EXPECT_EQ(at(15), 0x11u);
+
+    const std::size_t rec = sizeof(spsc::wire::PacketHeader);
+    EXPECT_EQ(at(rec + 0), 0x08u);              // seq
+    EXPECT_EQ(at(rec + 7), 0x01u);
+    EXPECT_EQ(at(rec + 8), 0xFEu);              // price_ticks -2
+    EXPECT_EQ(at(rec + 15), 0xFFu);
+    EXPECT_EQ(at(rec + 16), 0x0Du);             // instrument_id
+    EXPECT_EQ(at(rec + 19), 0x0Au);
+}
+
+TEST(FeedPacket, RoundTripsAndRejectsMalformed) {
+    spsc::Event in[3]{};
+    for (std::uint64_t i = 0; i < 3; ++i) {
+        in[i].seq = 10 + i;
+        in[i].price_ticks = -5 + static_cast<std::int64_t>(i);
+        in[i].instrument_id = 7;
+        in[i].qty = 100;
+        in[i].type = spsc::EventType::Quote;
+        in[i].side = spsc::Side::Sell;
+    }
+
+    std::byte buf[spsc::wire::kMaxDatagram];
+    const std::size_t len = spsc::wire::encode_packet(buf, sizeof(buf), 42, 1, in, 3);
+    ASSERT_EQ(len, sizeof(spsc::wire::PacketHeader) + 3 * sizeof(spsc::wire::EventRecord));
+
+    std::vector<spsc::Event> out;
+    spsc::wire::PacketHeader h;
+    ASSERT_TRUE(spsc::wire::decode_packet(buf, len, 999, h, [&](const spsc::Event& e) { out.push_back(e); }));
+    EXPECT_EQ(h.packet_seq, 42u);
+    ASSERT_EQ(out.size(), 3u);
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(out[i].seq, in[i].seq);
+        EXPECT_EQ(out[i].price_ticks, in[i].price_ticks);
+        EXPECT_EQ(out[i].instrument_id, 7u);
+        EXPECT_EQ(out[i].type, spsc::EventType::Quote);
+        EXPECT_EQ(out[i].side, spsc::Side::Sell);
+        EXPECT_EQ(out[i].enqueue_ns, 999u);             // stamped with the receive time
+    }
+
+    // Truncated, short and foreign datagrams deliver nothing
+    out.clear();
+    auto sink = [&](const spsc::Event& e) { out.push_back(e); };
+    EXPECT_FALSE(spsc::wire::decode_packet(buf, len - 1, 0, h, sink));
+    EXPECT_FALSE(spsc::wire::decode_packet(buf, 4, 0, h, sink));
+    buf[0] = std::byte{0};
+    EXPECT_FALSE(spsc::wire::decode_packet(buf, len, 0, h, sink));
+    EXPECT_TRUE(out.empty());
+
+    // Out-of-range enum bytes in any record reject the whole packet
+    constexpr std::size_t kTypeOffset = sizeof(spsc::wire::PacketHeader) + offsetof(spsc::wire::EventRecord, type);
+    constexpr std::size_t kSideOffset = sizeof(spsc::wire::PacketHeader) + offsetof(spsc::wire::EventRecord, side);
+    constexpr std::size_t kLast = 2 * sizeof(spsc::wire::EventRecord);
+
+    spsc::wire::encode_packet(buf, sizeof(buf), 43, 1, in, 3);
+    buf[kLast + kTypeOffset] = std::byte{3};
+    EXPECT_FALSE(spsc::wire::decode_packet(buf, len, 0, h, sink));
+
+    spsc::wire::encode_packet(buf, sizeof(buf), 44, 1, in, 3);
+    buf[kLast + kSideOffset] = std::byte{0xFF};
+    EXPECT_FALSE(spsc::wire::decode_packet(buf, len, 0, h, sink));
+    EXPECT_TRUE(out.empty());
+
+    // Never more than fits one MTU
+    EXPECT_EQ(spsc::wire::encode_packet(buf, 10, 0, 0, in, 3), 0u);
+}
+
+#if SPSC_UDP_INGEST
+
+TEST(UdpIngest, ReceivesBatchesFromLoopbackSender) {
+    spsc::UdpIngest in("127.0.0.1:0", 8);
+    ASSERT_NE(in.port(), 0);
+
+    spsc::UdpSender tx(loopback(in.port()), 4);
+    ASSERT_EQ(tx.send(20, 5), 20u);
+    EXPECT_EQ(tx.events_sent(), 100u);
+
+    const auto packets = receive_all(in, 20);
+    ASSERT_EQ(packets.size(), 20u);
+
+    std::uint64_t seq = 0;
+    for (const auto& events : packets) {
+        ASSERT_EQ(events.size(), 5u);
+        for (const auto& e : events) EXPECT_EQ(e.seq, seq++);
+    }
+}
+
+TEST(UdpIngest, SenderGivesUpOnADeadReceiver) {
+    // A port that was just released: nothing listens, loopback answers with ECONNREFUSED
+    std::uint16_t port = 0;
+    {
+        spsc::UdpIngest probe("127.0.0.1:0", 8);
+        port = probe.port();
+    }
+
+    spsc::UdpSender tx(loopback(port), 4);
+    const std::uint64_t sent = tx.send(2'000, 1);
+
+    EXPECT_EQ(sent, tx.packets_sent());
+    EXPECT_EQ(sent + tx.packets_dropped(), 2'000u);
+}
+
+TEST(UdpIngest, RejectsBadEndpoints) {
+    EXPECT_THROW(spsc::UdpIngest("127.0.0.1", 8), std::system_error);
+    EXPECT_THROW(spsc::UdpIngest("not-an-ip:1", 8), std::system_error);
+    EXPECT_THROW(spsc::UdpIngest("127.0.0.1:99999", 8), std::system_error);
+
+    // Not a local address: bind fails
+    EXPECT_THROW(spsc::UdpIngest("192.0.2.1:0", 8), std::system_error);
+}
+
+TEST(EventBus, IngestsUdpFeedIntoRing) {
+    spsc::EventBus::Options opts;
+    opts.ring_capacity = 64;                    // smaller than the feed: exercises ring backpressure
+    opts.max_latency_samples = 4096;
+    opts.wait = spsc::WaitStrategy::Yield;
+    opts.udp_listen = "127.0.0.1:0";
+    opts.udp_batch = 8;
+
+    spsc::EventBus bus(opts);
+    ASSERT_NE(bus.ingest(), nullptr);
+
+    spsc::UdpSender tx(loopback(bus.ingest()->port()), 8);
+
+    constexpr std::uint64_t kPackets = 200;
+    constexpr std::size_t kPerPacket = 10;
+    bus.start(kPackets * kPerPacket);
+
+    // Paced so the default socket buffer never overflows; stop the bus if datagrams were lost anyway
+    tx.send(kPackets, kPerPacket, 20'000);
+    auto done = std::async(std::launch::async, [&] { bus.join(); });
+    if (done.wait_for(std::chrono::seconds(5)) == std::future_status::timeout) bus.stop();
+    done.get();
+
+    const auto c = bus.counters();
+    EXPECT_EQ(c.packets, kPackets);
+    EXPECT_EQ(c.packet_gaps, 0u);
+    EXPECT_EQ(c.bad_packets, 0u);
+    EXPECT_EQ(c.produced, kPackets * kPerPacket);
+    EXPECT_EQ(c.consumed, kPackets * kPerPacket);
+    EXPECT_EQ(c.seq_mismatch, 0u);
+
+    // Wire-to-dequeue: every event measured from its packet's receive time
+    const auto s = bus.latency_stats();
+    EXPECT_EQ(s.count, kPackets * kPerPacket);
+    EXPECT_GT(s.max_ns, 0u);
+}
+
+#endif